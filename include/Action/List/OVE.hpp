@@ -17,7 +17,7 @@ namespace Action::List
 {
     /**
      * @class OVE
-     * @brief Action when the player moves
+     * @brief Action when the player changes the direction it holds
      */
     class OVE : public Action::AAction
     {
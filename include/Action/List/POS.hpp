@@ -17,7 +17,7 @@ namespace Action::List
 {
     /**
      * @class POS
-     * @brief Action to broadcast the position of entities
+     * @brief Action to send a player the positions that changed since the last snapshot it acknowledged
      */
     class POS : public Action::AAction
     {
@@ -26,8 +26,9 @@ namespace Action::List
              * @brief Handle sending a message to a session
              *
              * @param id The session identifier to which the message is sent
-             * @param content The content to be sent, must be a vector of position updates:
-             *        vector<tuple<Entity, uint32_t, Position>>
+             * @param content The content to be sent, must be the snapshot number, the baseline number, the last applied
+             *        input number and the positions encoded against the baseline:
+             *        tuple<uint32_t, uint32_t, uint32_t, vector<tuple<uint32_t, Entity, Position>>>
              */
             void SendMessage(const std::uint32_t id, const std::any& content) const override;
     };
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "Miscellaneous/Clock.hpp"
+#include "Miscellaneous/Queue.hpp"
 #include "Engine/Collision.hpp"
 #include "Network/Player.hpp"
 #include "Engine/Wave.hpp"
@@ -19,6 +20,7 @@
 #include <optional>
 #include <cstdint>
 #include <vector>
+#include <atomic>
 
 /**
  * @namespace Engine
@@ -33,6 +35,31 @@ namespace Engine
     class Game
     {
         public:
+            /**
+             * @struct Command
+             * @brief An input decoded by a network thread, applied by the thread processing the game
+             */
+            struct Command {
+                /**
+                 * @enum Type
+                 * @brief The different kinds of commands
+                 */
+                enum class Type : std::uint8_t {
+                    Move = 0, /*!< Change the direction held by the player */
+                    Shoot = 1, /*!< Fire a missile from the player position, against the enemies of the snapshot the player was viewing */
+                    Join = 2, /*!< Add the player to the game */
+                    Leave = 3, /*!< Remove the player from the game */
+                    Start = 4, /*!< Start the game */
+                    God = 5, /*!< Toggle the god mode shield of the player */
+                    Acknowledge = 6 /*!< Record the last position snapshot received by the player */
+                };
+
+                Type type; /*!< The kind of command */
+                std::uint32_t player; /*!< The unique identifier of the player issuing the command */
+                std::uint32_t value; /*!< The argument of the command, such as the direction of a move or a snapshot number */
+                std::uint32_t sequence = 0; /*!< The client sequence number of an input, 0 if the input is not numbered */
+            };
+
             /**
              * @brief Create a new game
              */
@@ -153,7 +180,14 @@ namespace Engine
             bool IsInactive();
 
             /**
-             * @brief Process the game logic for the
+             * @brief Queue a command to be applied at the beginning of the next tick, safe to call from any thread
+             *
+             * @param command The command to queue
+             */
+            void Push(const Command& command);
+
+            /**
+             * @brief Apply the queued commands then process the game logic for the tick and commit its datagrams
              */
             void Process();
 
@@ -173,7 +207,7 @@ namespace Engine
             void Next();
 
             /**
-             * @brief Queue a position update to be sent later in batch
+             * @brief Record the position of an entity, sent to the players with the next snapshot
              *
              * @param entity The type of entity
              * @param id The unique identifier of the entity
@@ -288,9 +322,109 @@ namespace Engine
                 Inactivity = 0, /*!< Clock for checking inactivity */
                 Shield = 1, /*!< Clock for player shields */
                 Wave = 2, /*!< Clock for wave processing */
-                Move = 3 /*!< Clock for moving entities */
+                Move = 3, /*!< Clock for moving entities */
+                Report = 4 /*!< Clock for latency reports */
             };
 
+            /**
+             * @struct Snapshot
+             * @brief The positions sent to a player in a message, applied to its known state once acknowledged
+             */
+            struct Snapshot {
+                std::uint32_t sequence = 0; /*!< The number of the snapshot, 0 if the slot of the ring is unused */
+                std::uint32_t baseline = 0; /*!< The number of the acknowledged snapshot the positions are encoded against */
+                std::uint32_t tick = 0; /*!< The game tick the snapshot was sent on */
+                std::vector<std::pair<std::uint64_t, Position>> changes = {}; /*!< The positions sent keyed by entity type and identifier */
+            };
+
+            /**
+             * @struct Frame
+             * @brief The position of every enemy at the end of a past tick, used to rewind shots to the time the shooter saw
+             */
+            struct Frame {
+                std::uint32_t tick = 0; /*!< The game tick of the frame, 0 if the slot of the ring is unused */
+                std::vector<std::pair<std::uint64_t, Position>> positions = {}; /*!< The enemy positions keyed by type and identifier */
+            };
+
+            /**
+             * @brief Build the key of an entity in the snapshots
+             *
+             * @param id The unique identifier of the entity
+             * @param entity The type of entity
+             * @return The type in the high half and the identifier in the low half
+             */
+            static std::uint64_t GetEntityKey(const std::uint32_t id, const std::uint8_t entity);
+
+            /**
+             * @brief Get a snapshot sent to a player slot and still kept in its ring
+             *
+             * @param slot The player slot
+             * @param sequence The number of the snapshot
+             * @return A pointer to the snapshot, or nullptr if it is unknown or was overwritten
+             */
+            const Snapshot* GetSnapshot(const std::uint8_t slot, const std::uint32_t sequence) const;
+
+            /**
+             * @brief Record the position of every enemy at the end of the current tick into the rewind ring
+             */
+            void RecordFrame();
+
+            /**
+             * @brief Get the frame of a past tick still kept in the rewind ring and within the rewind limit
+             *
+             * @param tick The game tick
+             * @return A pointer to the frame, or nullptr if it is unknown, overwritten or too old
+             */
+            const Frame* GetFrame(const std::uint32_t tick) const;
+
+            /**
+             * @brief Fire a missile from a player, hitting the enemies where they were in the snapshot it was viewing
+             *
+             * @param player The player shooting
+             * @param snapshot The number of the latest snapshot the player had received when shooting, 0 if unknown
+             */
+            void Shoot(const std::shared_ptr<Network::Player>& player, const std::uint32_t snapshot);
+
+            /**
+             * @brief Compute the priority an entity position gains for a player on each tick it is not sent
+             *
+             * @param key The key of the entity in the snapshots
+             * @param position The position of the entity
+             * @param viewer The unique identifier of the player receiving the position
+             * @param origin The position of the player receiving the position
+             * @return The priority gained, higher for players and for entities close to the receiving player
+             */
+            static float GetPriority(const std::uint64_t key, const Position& position, const std::uint32_t viewer, const Position& origin);
+
+            /**
+             * @brief Forget the snapshots and priorities of a player slot so that it receives the full state again
+             *
+             * @param slot The player slot
+             */
+            void ResetSnapshots(const std::uint8_t slot);
+
+            /**
+             * @brief Stop sending the position of an entity that left the game
+             *
+             * @param id The unique identifier of the entity
+             * @param entity The type of entity
+             */
+            void ForgetPosition(const std::uint32_t id, const std::uint8_t entity);
+
+            /**
+             * @brief Forget every snapshot so that each player receives the full state again
+             */
+            void ResetSnapshots();
+
+            /**
+             * @brief Use a snapshot received by a player as its baseline for later deltas, ignored unless it was
+             * encoded against the current baseline
+             *
+             * @param id The unique identifier of the player
+             * @param sequence The number of the received snapshot
+             */
+            void AcknowledgeSnapshot(const std::uint32_t id, const std::uint32_t sequence);
+
             /**
              * @brief Convert a Missile enum value to its string representation
              *
@@ -355,17 +489,64 @@ namespace Engine
              */
             void ApplyCollisions(const Collision::Result& result);
 
+            /**
+             * @brief Move every living player along the direction it holds
+             *
+             * @param elapsed The duration of the tick in seconds
+             */
+            void MovePlayers(const float elapsed);
+
             /**
              * @brief Process internal game logic such as moving missiles and checking collisions
              */
             void MoveEntities();
 
             /**
-             * @brief Send all queued position updates to all players in the game
+             * @brief Send each player the positions that changed since the last snapshot it acknowledged, highest
+             * priority first and within its bandwidth budget, again after a delay until it acknowledges them
              */
             void SendPosition();
 
-            std::vector<std::tuple<std::uint32_t, std::uint8_t, Position>> _positions; /*!< Queue of position updates to be sent in batch */
+            /**
+             * @brief Queue the reliable messages of the players due for a redundant send or a resend, and their latency
+             * probes
+             */
+            void ResendMessages();
+
+            /**
+             * @brief Log the round trip time, jitter and loss of every player in the game
+             */
+            void ReportLatency();
+
+            /**
+             * @brief Apply every command queued since the last tick
+             */
+            void ApplyCommands();
+
+            /**
+             * @brief Apply a single command
+             *
+             * @param command The command to apply
+             */
+            void ApplyCommand(const Command& command);
+
+            Misc::Queue<Command> _commands; /*!< Commands pushed by the network threads */
+
+            std::unordered_map<std::uint64_t, Position> _world; /*!< The latest position of every entity keyed by type and identifier */
+            std::array<std::array<Snapshot, SNAPSHOT_HISTORY_SIZE>, MAX_PLAYER_PER_GAMES> _snapshots; /*!< Ring of the snapshots sent to each player slot indexed by sequence number */
+            std::array<std::unordered_map<std::uint64_t, Position>, MAX_PLAYER_PER_GAMES> _known; /*!< The positions held by each player slot as of its last acknowledged snapshot */
+            std::array<Misc::Clock, MAX_PLAYER_PER_GAMES> _resends; /*!< Time since the positions of each player slot were last compared with the world */
+            std::array<std::unordered_map<std::uint64_t, float>, MAX_PLAYER_PER_GAMES> _priorities; /*!< Priority accumulated by the positions not sent yet to each player slot */
+            std::array<std::uint32_t, MAX_PLAYER_PER_GAMES> _sequences; /*!< The number of the latest snapshot sent to each player slot */
+            std::array<std::uint32_t, MAX_PLAYER_PER_GAMES> _acknowledged; /*!< The last snapshot acknowledged by each player slot, 0 if none */
+            std::array<std::uint32_t, MAX_PLAYER_PER_GAMES> _inputs; /*!< The sequence number of the last input applied for each player slot */
+            std::array<std::uint32_t, MAX_PLAYER_PER_GAMES> _echoed; /*!< The input sequence number last echoed to each player slot */
+            std::array<bool, MAX_PLAYER_PER_GAMES> _pending; /*!< Whether a position changed, was acknowledged or did not fit the budget since the last send to each player slot */
+            std::size_t _budget; /*!< The number of position bits sent to each player per tick */
+            std::array<Frame, REWIND_HISTORY_SIZE> _frames; /*!< Ring of the enemy positions of the recent ticks indexed by tick */
+            std::uint32_t _tick; /*!< The number of ticks processed since the game started */
+            std::uint32_t _rewind; /*!< The maximum number of ticks a shot is rewound by */
+            std::uint16_t _tickrate; /*!< The number of game ticks per second */
             std::array<std::uint32_t, MAX_PLAYER_PER_GAMES> _ids; /*!< Array of player identigiers */
             std::unordered_map<TimedEvent, Misc::Clock> _clocks; /*!< Map of clocks for timing events */
             std::unique_ptr<Wave> _wave; /*!< Unique pointer to the current wave */
@@ -375,6 +556,6 @@ namespace Engine
             Enemies _enemies; /*!< Structure holding different types of enemies */
             Items _items; /*!< Structure holding different types of items */
             bool _inactive; /*!< Whether the game is checking for inactivity */
-            bool _started; /*!< Whether the game has started or not */
+            std::atomic<bool> _started; /*!< Whether the game has started or not */
     };
 }
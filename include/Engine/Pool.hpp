@@ -0,0 +1,76 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Pool.hpp
+*/
+
+#pragma once
+
+#include "Miscellaneous/Clock.hpp"
+#include "Engine/Worker.hpp"
+
+#include <unordered_map>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @namespace Engine
+ * @brief Contains classes and functions related to the game engine
+ */
+namespace Engine
+{
+    /**
+     * @class Pool
+     * @brief Shards the games over a fixed set of workers and lets idle workers steal from busy ones
+     */
+    class Pool
+    {
+        public:
+            /**
+             * @brief Create the pool and start its workers
+             *
+             * @param count The number of workers to start
+             */
+            explicit Pool(const std::uint16_t count);
+
+            /**
+             * @brief Stop and join every worker
+             */
+            ~Pool();
+
+            /**
+             * @brief Pin new games to the least loaded worker, unpin removed ones and schedule a tick on every worker
+             *
+             * Must always be called from the same thread.
+             */
+            void Dispatch();
+
+            /**
+             * @brief Steal a job from another worker
+             *
+             * @param index The index of the worker looking for a job
+             * @return The stolen job, or nullptr if every other run queue is empty
+             */
+            std::shared_ptr<Worker::Job> Steal(const std::size_t index);
+
+            /**
+             * @brief Get the utilisation of each worker over the last report interval
+             *
+             * @return The ratio of time spent processing games, between 0 and 1, for each worker
+             */
+            const std::vector<float>& GetUtilisation() const;
+
+        private:
+            /**
+             * @brief Compute and log the utilisation of each worker
+             */
+            void Report();
+
+            std::vector<std::unique_ptr<Worker>> _workers; /*!< The workers of the pool */
+            std::unordered_map<std::uint32_t, std::size_t> _assignments; /*!< Map of game identifiers to worker indexes */
+            std::vector<float> _utilisation; /*!< Utilisation of each worker over the last report interval */
+            Misc::Clock _clock; /*!< Clock measuring the report interval */
+    };
+}
@@ -0,0 +1,58 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Scheduler.hpp
+*/
+
+#pragma once
+
+#include <functional>
+#include <cstdint>
+#include <chrono>
+#include <atomic>
+
+/**
+ * @namespace Engine
+ * @brief Contains classes and functions related to the game engine
+ */
+namespace Engine
+{
+    /**
+     * @class Scheduler
+     * @brief Fixed timestep scheduler sleeping between game ticks
+     */
+    class Scheduler
+    {
+        public:
+            /**
+             * @brief Create a new scheduler
+             *
+             * @param rate The number of ticks to run per second
+             */
+            explicit Scheduler(const std::uint16_t rate);
+
+            /**
+             * @brief Run ticks at a fixed rate until the running flag is cleared
+             *
+             * When a tick overruns its deadline, the missed ticks are run back to back
+             * up to MAX_CATCHUP_TICKS, the remaining ones are skipped.
+             *
+             * @param running Reference to atomic boolean controlling the running state
+             * @param tick The function to call on each tick
+             */
+            void Run(const std::atomic<bool>& running, const std::function<void()>& tick);
+
+            /**
+             * @brief Get the number of ticks processed since the scheduler started
+             *
+             * @return The number of processed ticks
+             */
+            std::uint64_t GetTick() const;
+
+        private:
+            std::chrono::steady_clock::duration _interval; /*!< Duration of a single tick */
+            std::chrono::steady_clock::time_point _deadline; /*!< Time point at which the next tick is due */
+            std::uint64_t _tick; /*!< Number of processed ticks */
+    };
+}
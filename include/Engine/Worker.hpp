@@ -0,0 +1,162 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Worker.hpp
+*/
+
+#pragma once
+
+#include <unordered_map>
+#include <cstdint>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <deque>
+#include <mutex>
+
+/**
+ * @namespace Engine
+ * @brief Contains classes and functions related to the game engine
+ */
+namespace Engine
+{
+    class Pool;
+
+    /**
+     * @class Worker
+     * @brief A thread processing the games pinned to it once per tick and stealing from other workers when idle
+     */
+    class Worker
+    {
+        public:
+            /**
+             * @struct Job
+             * @brief A game pinned to a worker along with its estimated cost
+             */
+            struct Job {
+                std::uint32_t id; /*!< The unique identifier of the game */
+                std::atomic<std::uint32_t> cost; /*!< Moving average of the game tick duration in microseconds */
+                std::atomic<bool> queued; /*!< Whether the game is waiting in a run queue */
+            };
+
+            /**
+             * @brief Create the worker and start its thread
+             *
+             * @param index The index of the worker in the pool
+             * @param pool The pool the worker belongs to, used to steal jobs
+             */
+            explicit Worker(const std::size_t index, Pool& pool);
+
+            /**
+             * @brief Stop the worker and join its thread
+             */
+            ~Worker();
+
+            /**
+             * @brief Pin a game to this worker
+             *
+             * @param id The unique identifier of the game
+             */
+            void Assign(const std::uint32_t id);
+
+            /**
+             * @brief Unpin a game from this worker
+             *
+             * @param id The unique identifier of the game
+             */
+            void Release(const std::uint32_t id);
+
+            /**
+             * @brief Queue every pinned game not already queued, most expensive first, and wake the worker
+             */
+            void Schedule();
+
+            /**
+             * @brief Take the cheapest job from the back of the run queue
+             *
+             * @return The stolen job, or nullptr if the run queue is empty
+             */
+            std::shared_ptr<Job> Steal();
+
+            /**
+             * @brief Get the summed estimated cost of the pinned games
+             *
+             * @return The estimated cost of a tick in microseconds
+             */
+            std::uint64_t GetLoad() const;
+
+            /**
+             * @brief Get the number of games pinned to this worker
+             *
+             * @return The number of games
+             */
+            std::size_t GetCount() const;
+
+            /**
+             * @brief Get the time spent processing games since the last call
+             *
+             * @return The busy time in microseconds
+             */
+            std::uint64_t ConsumeBusyTime();
+
+            /**
+             * @brief Ask the worker to stop after its current tick
+             */
+            void Stop();
+
+            /**
+             * @brief Wait for the worker thread to finish
+             */
+            void Join();
+
+        private:
+            /**
+             * @struct Unqueue
+             * @brief Clear the queued flag of a job when leaving the scope, however its tick ended
+             */
+            struct Unqueue {
+                Job& job; /*!< The job being run */
+
+                /**
+                 * @brief Mark the job as ready to be queued again
+                 */
+                ~Unqueue();
+            };
+
+            /**
+             * @brief Wait for ticks and process the queued games until the worker is stopped
+             */
+            void Loop();
+
+            /**
+             * @brief Drain the own run queue, then steal from the other workers until all are empty
+             */
+            void Process();
+
+            /**
+             * @brief Process a single game and update its estimated cost
+             *
+             * @param job The job to process
+             */
+            void Run(const std::shared_ptr<Job>& job);
+
+            /**
+             * @brief Take the most expensive job from the front of the run queue
+             *
+             * @return The job, or nullptr if the run queue is empty
+             */
+            std::shared_ptr<Job> Pop();
+
+            std::unordered_map<std::uint32_t, std::shared_ptr<Job>> _jobs; /*!< Games pinned to this worker */
+            std::deque<std::shared_ptr<Job>> _queue; /*!< Games waiting to be processed this tick */
+            mutable std::mutex _jobsMutex; /*!< Mutex protecting the pinned games */
+            mutable std::mutex _queueMutex; /*!< Mutex protecting the run queue */
+            std::atomic<std::uint64_t> _busy; /*!< Time spent processing games in microseconds */
+            std::atomic<std::uint64_t> _tick; /*!< Last tick published by the scheduler */
+            std::atomic<bool> _running; /*!< Whether the worker must keep running */
+            std::size_t _index; /*!< The index of the worker in the pool */
+            Pool& _pool; /*!< The pool the worker belongs to */
+            std::thread _thread; /*!< The thread running the worker loop */
+    };
+}
@@ -47,6 +47,10 @@ namespace Misc
              */
             struct Server {
                 std::uint16_t port; /*!< The port number of the server */
+                std::uint16_t tickrate; /*!< The number of game ticks per second */
+                std::uint16_t workers; /*!< The number of threads processing the games */
+                std::uint16_t receivers; /*!< The number of datagram sockets sharing the port, each with its own receive thread */
+                std::uint32_t bandwidth; /*!< The number of position bytes sent to each player per second */
             };
 
             /**
@@ -0,0 +1,107 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Queue.hpp
+*/
+
+#pragma once
+
+#include <optional>
+#include <utility>
+#include <atomic>
+
+/**
+ * @namespace Misc
+ * @brief Contains miscellaneous utility classes and functions.
+ */
+namespace Misc
+{
+    /**
+     * @class Queue
+     *
+     * @brief A lock-free unbounded queue with multiple producers and a single consumer.
+     *
+     * Producers only perform one atomic exchange per push, the consumer never blocks them.
+     */
+    template <typename T>
+    class Queue
+    {
+        public:
+            /**
+             * @brief Create an empty queue.
+             */
+            Queue() : _head(new Node()), _tail(_head.load()) {}
+
+            /**
+             * @brief Destroy the queue and every value still in it.
+             */
+            ~Queue() {
+                while (_tail) {
+                    Node* next = _tail->next.load();
+
+                    delete _tail;
+                    _tail = next;
+                }
+            }
+
+            /**
+             * @brief Deleted copy constructor to prevent copying of the queue.
+             *
+             * @param other The other queue to copy from.
+             */
+            Queue(const Queue& other) = delete;
+
+            /**
+             * @brief Deleted assignment operator to prevent assignment of the queue.
+             *
+             * @param other The other queue to assign from.
+             */
+            Queue& operator=(const Queue& other) = delete;
+
+            /**
+             * @brief Push a value at the end of the queue, safe to call from any thread.
+             *
+             * @param value The value to push.
+             */
+            void Push(T value) {
+                Node* node = new Node();
+
+                node->value = std::move(value);
+                Node* previous = _head.exchange(node, std::memory_order_acq_rel);
+                previous->next.store(node, std::memory_order_release);
+            }
+
+            /**
+             * @brief Pop the value at the front of the queue, must only be called from the consumer thread.
+             *
+             * @return The value, or std::nullopt if the queue is empty.
+             */
+            std::optional<T> Pop() {
+                Node* next = _tail->next.load(std::memory_order_acquire);
+
+                if (!next) {
+                    return std::nullopt;
+                }
+
+                std::optional<T> value = std::move(next->value);
+
+                delete _tail;
+                _tail = next;
+                return value;
+            }
+
+        private:
+            /**
+             * @struct Node
+             * @brief A node of the queue, the consumer always keeps the last popped node as a stub.
+             */
+            struct Node {
+                std::atomic<Node*> next = nullptr; /*!< The next node, published by the producer */
+                T value = {}; /*!< The value held by the node */
+            };
+
+            std::atomic<Node*> _head; /*!< The last pushed node, shared by the producers */
+            Node* _tail; /*!< The stub node before the first value, owned by the consumer */
+    };
+}
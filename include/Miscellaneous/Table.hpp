@@ -0,0 +1,199 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Table.hpp
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @namespace Misc
+ * @brief Contains miscellaneous utility classes and functions.
+ */
+namespace Misc
+{
+    /**
+     * @class Table
+     *
+     * @brief An open addressing hash table keyed by 64-bit integers.
+     *
+     * Every slot lives in a single contiguous vector probed linearly, so a lookup never allocates and touches a few
+     * neighbouring cache lines at most. Removed slots are marked and reused, the table is rebuilt when they pile up.
+     */
+    template <typename T>
+    class Table
+    {
+        public:
+            /**
+             * @brief Create an empty table.
+             *
+             * @param capacity The initial number of slots, rounded up to a power of two.
+             */
+            explicit Table(const std::size_t capacity = 64) : _slots(RoundUp(capacity)), _size(0), _used(0) {}
+
+            /**
+             * @brief Insert a value or replace the one already stored under the key.
+             *
+             * @param key The key of the value.
+             * @param value The value to store.
+             * @return True if the key was not present yet, false if its value was replaced.
+             */
+            bool Insert(const std::uint64_t key, T value) {
+                if ((_used + 1) * 4 > _slots.size() * 3) {
+                    Rebuild();
+                }
+
+                const std::size_t mask = _slots.size() - 1;
+                std::size_t index = Hash(key) & mask;
+                Slot* reusable = nullptr;
+
+                for (; _slots[index].state != State::Empty; index = (index + 1) & mask) {
+                    if (_slots[index].state == State::Used && _slots[index].key == key) {
+                        _slots[index].value = std::move(value);
+                        return false;
+                    } else if (_slots[index].state == State::Removed && !reusable) {
+                        reusable = &_slots[index];
+                    }
+                }
+                if (!reusable) {
+                    reusable = &_slots[index];
+                    _used++;
+                }
+                *reusable = { .key = key, .state = State::Used, .value = std::move(value) };
+                _size++;
+                return true;
+            }
+
+            /**
+             * @brief Remove the value stored under a key.
+             *
+             * @param key The key of the value.
+             * @return True if a value was removed, false if the key was not present.
+             */
+            bool Erase(const std::uint64_t key) {
+                const std::size_t index = Locate(key);
+
+                if (index == _slots.size()) {
+                    return false;
+                }
+                _slots[index].state = State::Removed;
+                _slots[index].value = T();
+                _size--;
+                return true;
+            }
+
+            /**
+             * @brief Find the value stored under a key.
+             *
+             * @param key The key of the value.
+             * @return A pointer to the value, or nullptr if the key is not present.
+             */
+            const T* Find(const std::uint64_t key) const {
+                const std::size_t index = Locate(key);
+
+                return index != _slots.size() ? &_slots[index].value : nullptr;
+            }
+
+            /**
+             * @brief Get the number of stored values.
+             *
+             * @return The number of values.
+             */
+            std::size_t GetSize() const {
+                return _size;
+            }
+
+        private:
+            /**
+             * @enum State
+             * @brief The occupation of a slot.
+             */
+            enum class State : std::uint8_t {
+                Empty, /*!< Never used, ends a probe sequence */
+                Used, /*!< Holds a value */
+                Removed /*!< Held a value, probes continue past it */
+            };
+
+            /**
+             * @struct Slot
+             * @brief A key and its value.
+             */
+            struct Slot {
+                std::uint64_t key = 0; /*!< The key of the value */
+                State state = State::Empty; /*!< The occupation of the slot */
+                T value = T(); /*!< The stored value */
+            };
+
+            /**
+             * @brief Spread the bits of a key so that consecutive keys land far apart.
+             *
+             * @param key The key to hash.
+             * @return The hash of the key.
+             */
+            static std::uint64_t Hash(std::uint64_t key) {
+                key ^= key >> 33;
+                key *= 0xff51afd7ed558ccdULL;
+                key ^= key >> 33;
+                key *= 0xc4ceb9fe1a85ec53ULL;
+                key ^= key >> 33;
+                return key;
+            }
+
+            /**
+             * @brief Round a capacity up to the next power of two.
+             *
+             * @param capacity The requested capacity.
+             * @return The rounded capacity, at least 8.
+             */
+            static std::size_t RoundUp(const std::size_t capacity) {
+                std::size_t result = 8;
+
+                while (result < capacity) {
+                    result <<= 1;
+                }
+                return result;
+            }
+
+            /**
+             * @brief Find the slot holding a key.
+             *
+             * @param key The key to look for.
+             * @return The index of the slot, or the slot count if the key is not present.
+             */
+            std::size_t Locate(const std::uint64_t key) const {
+                const std::size_t mask = _slots.size() - 1;
+
+                for (std::size_t index = Hash(key) & mask; _slots[index].state != State::Empty; index = (index + 1) & mask) {
+                    if (_slots[index].state == State::Used && _slots[index].key == key) {
+                        return index;
+                    }
+                }
+                return _slots.size();
+            }
+
+            /**
+             * @brief Move every value to a new slot vector, doubling it when more than half of the slots hold values.
+             */
+            void Rebuild() {
+                std::vector<Slot> previous(RoundUp(_size * 2 + 1 > _slots.size() ? _slots.size() * 2 : _slots.size()));
+
+                previous.swap(_slots);
+                _size = 0;
+                _used = 0;
+                for (Slot& slot : previous) {
+                    if (slot.state == State::Used) {
+                        Insert(slot.key, std::move(slot.value));
+                    }
+                }
+            }
+
+            std::vector<Slot> _slots; /*!< The slots, their count is a power of two */
+            std::size_t _size; /*!< The number of slots holding a value */
+            std::size_t _used; /*!< The number of slots holding a value or marked as removed */
+    };
+}
@@ -155,7 +155,69 @@ namespace Misc
              */
             static std::uint32_t GetNextId(const std::string& key);
 
+            /**
+             * @brief Append the lowest bits of a value to a bit-packed message, least significant bit first
+             *
+             * @param data The message, grown as needed
+             * @param offset The position of the next bit in the message, moved past the written bits
+             * @param value The value to write
+             * @param width The number of bits to write, at most 32
+             */
+            static void WriteBits(std::vector<std::uint8_t>& data, std::size_t& offset, const std::uint32_t value, const std::uint8_t width);
+
+            /**
+             * @brief Read a value from a bit-packed message, least significant bit first
+             *
+             * @param data The message
+             * @param offset The position of the next bit in the message, moved past the read bits
+             * @param width The number of bits to read, at most 32
+             * @return The read value
+             */
+            static std::uint32_t ReadBits(const std::vector<std::uint8_t>& data, std::size_t& offset, const std::uint8_t width);
+
+            /**
+             * @brief Append an identifier to a bit-packed message using the smallest width able to hold it
+             *
+             * @param data The message, grown as needed
+             * @param offset The position of the next bit in the message, moved past the written bits
+             * @param id The identifier to write
+             */
+            static void WriteId(std::vector<std::uint8_t>& data, std::size_t& offset, const std::uint32_t id);
+
+            /**
+             * @brief Read an identifier written by WriteId from a bit-packed message
+             *
+             * @param data The message
+             * @param offset The position of the next bit in the message, moved past the read bits
+             * @return The read identifier
+             */
+            static std::uint32_t ReadId(const std::vector<std::uint8_t>& data, std::size_t& offset);
+
+            /**
+             * @brief Get the number of bits WriteId uses for an identifier
+             *
+             * @param id The identifier
+             * @return The width of the prefix and of the value
+             */
+            static std::uint8_t GetIdBits(const std::uint32_t id);
+
+            /**
+             * @brief Check that the bit-packed POS, SPW and DIE layouts read back the values written, at the bounds of
+             * every identifier width and of the coordinates
+             *
+             * @throw Exception::GenericError If a value does not read back as written
+             */
+            static void CheckPacking();
+
         private:
+            /**
+             * @brief Select the smallest identifier width able to hold an identifier
+             *
+             * @param id The identifier
+             * @return The index of the width in PACKED_ID_WIDTHS
+             */
+            static std::size_t GetIdClass(const std::uint32_t id);
+
             /**
              * @brief Helper function to append one vector to another
              *
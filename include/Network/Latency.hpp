@@ -0,0 +1,98 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Latency.hpp
+*/
+
+#pragma once
+
+#include "Miscellaneous/Clock.hpp"
+
+#include <cstdint>
+#include <vector>
+#include <deque>
+#include <mutex>
+
+/**
+ * @namespace Network
+ * @brief Contains classes and functions related to network operations.
+ */
+namespace Network
+{
+    /**
+     * @class Latency
+     * @brief The latency estimates of a player.
+     *
+     * Probes carrying the server time are sent at a fixed interval and echoed by the player, each answer gives a round
+     * trip time sample and each probe left unanswered past the timeout is counted as lost.
+     */
+    class Latency
+    {
+        public:
+            /**
+             * @struct Estimate
+             * @brief The smoothed network conditions of a player.
+             */
+            struct Estimate {
+                float rtt; /*!< The round trip time in milliseconds */
+                float jitter; /*!< The variation between consecutive round trip times in milliseconds */
+                float loss; /*!< The fraction of probes left unanswered, between 0 and 1 */
+                std::uint32_t samples; /*!< The number of answered probes */
+            };
+
+            /**
+             * @brief Create estimates without any sample.
+             */
+            explicit Latency();
+
+            /**
+             * @brief Count the probes that timed out as lost, then start a new probe if the probe interval elapsed.
+             *
+             * @param body Vector filled with the body of the PNG message to send, cleared first.
+             * @return True if a probe is due, false otherwise.
+             */
+            bool Probe(std::vector<std::uint8_t>& body);
+
+            /**
+             * @brief Update the estimates with the answer to a probe.
+             *
+             * @param sequence The sequence number of the answered probe.
+             * @param timestamp The server time carried by the probe, in microseconds.
+             * @return True if the answer was used, false if it is unknown, duplicated or too late.
+             */
+            bool Record(const std::uint32_t sequence, const std::uint64_t timestamp);
+
+            /**
+             * @brief Get the current estimates.
+             *
+             * @return A copy of the estimates.
+             */
+            Estimate GetEstimate() const;
+
+        private:
+            /**
+             * @struct Outstanding
+             * @brief A probe not answered yet.
+             */
+            struct Outstanding {
+                std::uint32_t sequence; /*!< The sequence number of the probe */
+                std::uint64_t timestamp; /*!< The server time the probe was sent at, in microseconds */
+            };
+
+            /**
+             * @brief Get the server time shared by every player.
+             *
+             * @return The time of the monotonic clock in microseconds.
+             */
+            static std::uint64_t GetTimestamp();
+
+            mutable std::mutex _mutex; /*!< Mutex protecting the estimates */
+
+            std::deque<Outstanding> _outstanding; /*!< The probes not answered yet, oldest first */
+            Misc::Clock _clock; /*!< Time since the last probe was sent */
+            std::uint32_t _sequence; /*!< The sequence number of the latest probe */
+            float _last; /*!< The latest round trip time sample in milliseconds */
+            Estimate _estimate; /*!< The smoothed estimates */
+    };
+}
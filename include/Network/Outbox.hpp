@@ -0,0 +1,98 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Outbox.hpp
+*/
+
+#pragma once
+
+#include "Miscellaneous/Singleton.hpp"
+#include "Wrapper/Socket.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <vector>
+#include <mutex>
+
+/**
+ * @namespace Network
+ * @brief Contains classes and functions related to network operations.
+ */
+namespace Network
+{
+    /**
+     * @class Outbox
+     * @brief Keeps the list of players with pending output so the send threads only wake up when there is work
+     */
+    class Outbox : public Misc::Singleton<Outbox>
+    {
+        public:
+            /**
+             * @brief Mark a player as having pending output and wake the matching send thread
+             *
+             * @param protocol The protocol of the pending output
+             * @param id The unique identifier of the player
+             */
+            void Notify(const Wrapper::Socket::Protocol& protocol, const std::uint32_t id);
+
+            /**
+             * @brief Wait until players have pending output
+             *
+             * @param protocol The protocol handled by the calling send thread
+             * @param ready Vector filled with the identifiers of the players to visit, cleared first
+             * @param timeout Maximum time to wait in milliseconds
+             * @return True if at least one player is ready, false on timeout
+             */
+            bool Wait(const Wrapper::Socket::Protocol& protocol, std::vector<std::uint32_t>& ready, const std::uint32_t timeout);
+
+            /**
+             * @brief Wake the send thread of a deferred channel if players have pending output
+             *
+             * The datagram channel is deferred: notifications only record the player, the send thread runs once the
+             * game tick that produced the output commits it, so every message of the tick can be packed together.
+             *
+             * @param protocol The protocol of the pending output
+             */
+            void Commit(const Wrapper::Socket::Protocol& protocol);
+
+        private:
+            /**
+             * @struct Channel
+             * @brief The ready list of a single send thread
+             */
+            struct Channel {
+                std::vector<std::uint32_t> ready; /*!< Identifiers of the players with pending output */
+                std::condition_variable condition; /*!< Signaled when the ready list becomes non-empty */
+                std::mutex mutex; /*!< Mutex protecting the ready list */
+                bool deferred = false; /*!< Whether the send thread waits for a commit instead of the first notification */
+                bool committed = false; /*!< Whether the ready list was committed since the last wait */
+            };
+
+            /**
+             * @brief Allow Singleton to access the private constructor and destructor
+             */
+            friend class Misc::Singleton<Outbox>;
+
+            /**
+             * @brief Default constructor for the Outbox class to prevent direct instantiation
+             */
+            Outbox();
+
+            /**
+             * @brief Default destructor for the Outbox class to prevent direct destruction
+             */
+            ~Outbox() = default;
+
+            /**
+             * @brief Get the channel of a protocol
+             *
+             * @param protocol The protocol
+             * @return The channel
+             */
+            Channel& GetChannel(const Wrapper::Socket::Protocol& protocol);
+
+            Channel _tcp; /*!< Players with pending transmission control protocol output */
+            Channel _udp; /*!< Players with pending user datagram protocol output */
+    };
+}
@@ -8,11 +8,14 @@
 #pragma once
 
 #include "Miscellaneous/Clock.hpp"
+#include "Network/Reliable.hpp"
+#include "Network/Latency.hpp"
 #include "Wrapper/Socket.hpp"
 #include "Types.hpp"
 
 #include <unordered_map>
 #include <cstdint>
+#include <atomic>
 #include <vector>
 #include <queue>
 #include <mutex>
@@ -53,7 +56,10 @@ namespace Network
             ~Player();
 
             /**
-             * @brief Add a message to the player's message queue.
+             * @brief Add a message to the player's message queue and wake the send thread if the queue was empty.
+             *
+             * A full datagram queue drops its oldest message, a full stream queue evicts the player and ignores every
+             * later message.
              *
              * @param protocol The protocol of the message queue to push to.
              * @param message The message to be added to the queue.
@@ -76,6 +82,86 @@ namespace Network
              */
             bool HasMessage(const Wrapper::Socket::Protocol& protocol) const;
 
+            /**
+             * @brief Send a message on the reliable ordered datagram channel, the player is evicted if too many messages
+             * are waiting for an acknowledgement.
+             *
+             * @param message The message to be sent.
+             */
+            void PushReliable(const Message& message);
+
+            /**
+             * @brief Forget the reliable messages received by the player.
+             *
+             * @param latest The sequence number up to which every reliable message was received by the player.
+             * @param mask Bit i is set if sequence number latest + 1 + i was received.
+             */
+            void AcknowledgeReliable(const std::uint32_t latest, const std::uint32_t mask);
+
+            /**
+             * @brief Drop the reliable messages left from a previous game and restart their sequence numbers.
+             */
+            void ClearReliable();
+
+            /**
+             * @brief Queue the reliable messages due for a redundant send or whose resend timeout expired.
+             */
+            void ResendReliable();
+
+            /**
+             * @brief Queue a latency probe if the probe interval elapsed since the last one.
+             */
+            void SendPing();
+
+            /**
+             * @brief Update the latency estimates with the answer to a probe.
+             *
+             * @param sequence The sequence number of the answered probe.
+             * @param timestamp The server time carried by the probe, in microseconds.
+             * @return True if the answer was used, false if it is unknown, duplicated or too late.
+             */
+            bool RecordPing(const std::uint32_t sequence, const std::uint64_t timestamp);
+
+            /**
+             * @brief Get the smoothed round trip time, jitter and loss of the player.
+             *
+             * @return The latency estimates, without samples until the player answers a probe.
+             */
+            Latency::Estimate GetLatency() const;
+
+            /**
+             * @brief Mark the player to be disconnected because it does not keep up with its output.
+             */
+            void Evict();
+
+            /**
+             * @brief Check if the player has been marked to be disconnected.
+             *
+             * @return True if the player is evicted, false otherwise.
+             */
+            bool IsEvicted() const;
+
+            /**
+             * @brief Get the number of datagrams dropped because the player's queue was full.
+             *
+             * @return The number of dropped datagrams.
+             */
+            std::uint64_t GetDroppedCount() const;
+
+            /**
+             * @brief Set the encoding of the entity messages sent to the player.
+             *
+             * @param encoding The negotiated encoding.
+             */
+            void SetEncoding(const Encoding encoding);
+
+            /**
+             * @brief Get the encoding of the entity messages sent to the player.
+             *
+             * @return The negotiated encoding, plain until the player asks for another one.
+             */
+            Encoding GetEncoding() const;
+
             /**
              * @brief Connect the player using provided credentials.
              *
@@ -103,12 +189,26 @@ namespace Network
             bool Register(const std::string& username, const std::string& password);
 
             /**
-             * @brief Move the player in the specified direction.
+             * @brief Set the direction held by the player, kept until the next change.
+             *
+             * @param direction The direction to move the player in, or None to stop.
+             */
+            void SetDirection(const Direction& direction);
+
+            /**
+             * @brief Get the direction held by the player.
              *
-             * @param direction The direction to move the player.
+             * @return The direction the player moves in, or None if it stands still.
+             */
+            const Direction& GetDirection() const;
+
+            /**
+             * @brief Move the player in its held direction, keeping the fraction of a pixel left for the next call.
+             *
+             * @param elapsed The time in seconds spent holding the direction since the last call.
              * @return The new position of the player.
              */
-            const Position& Move(const Direction& direction);
+            const Position& Move(const float elapsed);
 
             /**
              * @brief Check if the player is connected.
@@ -127,6 +227,11 @@ namespace Network
              */
             std::uint16_t GetPort() const;
 
+            /**
+             * @brief Get client endpoint resolved once at connection
+             */
+            const struct sockaddr_in& GetEndpoint() const;
+
             /**
              * @brief Get unique identifier fetched from database
              *
@@ -232,13 +337,21 @@ namespace Network
             std::string _username; /*!< The username of the player */
             std::string _address; /*!< The address where the player is connected */
             std::uint16_t _port; /*!< The port where the player is connected */
+            struct sockaddr_in _endpoint; /*!< The resolved address and port used to send datagrams */
             std::uint32_t _id; /*!< The unique identifier of the player */
 
             std::unordered_map<Statistic, std::pair<Misc::Clock, bool>> _statistics; /*!< Clocks and statuses for various player statistics */
             Position _position; /*!< The current position of the player */
+            Direction _direction; /*!< The direction held by the player */
+            Misc::Maths::Vector2<float> _remainder; /*!< The fraction of a pixel travelled but not applied to the position yet */
             Role _role; /*!< The role of the player fetched from database */
             bool _playing; /*!< Whether the player is currently in a game session */
             bool _alive; /*!< Whether the player is currently alive in the game */
             bool _god; /*!< Whether the player override the shield reset */
+            std::atomic<bool> _evicted; /*!< Whether the player is being disconnected for not keeping up with its output */
+            std::atomic<std::uint64_t> _dropped; /*!< Number of datagrams dropped from the full queue */
+            std::atomic<Encoding> _encoding; /*!< The encoding of the entity messages sent to the player */
+            Reliable _reliable; /*!< The reliable ordered datagram channel of the player */
+            Latency _latency; /*!< The latency estimates of the player */
     };
 }
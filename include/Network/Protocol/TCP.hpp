@@ -10,6 +10,8 @@
 #include "Wrapper/Socket.hpp"
 #include "Types.hpp"
 
+#include <unordered_map>
+#include <deque>
 #include <vector>
 #include <cstdint>
 
@@ -22,12 +24,17 @@ namespace Network::Protocol
     /**
      * @class TCP
      * @brief Manage transmission control protocol communications
+     *
+     * Client sockets are non-blocking, the bytes read from each of them are appended to a reassembly buffer from which
+     * every complete frame is dispatched. A frame announcing a body larger than MAX_TCP_FRAME_SIZE disconnects the client.
+     * Outgoing frames are queued per player and written with gathered writes, the header and body of each frame being
+     * handed to the kernel as separate buffers. A player with more than MAX_TCP_PENDING_BYTES unsent is evicted.
      */
     class TCP
     {
         public:
             /**
-             * @brief Look for messages from the client and process them
+             * @brief Read everything the client sent until the socket would block and process the complete messages
              *
              * @param socket The client socket to receive data from
              * @return Whether to disconnect the client or not
@@ -35,12 +42,31 @@ namespace Network::Protocol
             bool ReceiveMessage(const Wrapper::Socket::SocketType socket);
 
             /**
-             * @brief Look for messages and send them to the client by session identifier
+             * @brief Drop the reassembly buffer of a client, must be called from the receiving thread
+             *
+             * @param socket The client socket being closed
+             */
+            void Release(const Wrapper::Socket::SocketType socket);
+
+            /**
+             * @brief Append the pending messages of the client to its output queue and write as much of it as possible
              *
              * @param socket The client socket to send data to
              */
             void SendMessage(const Wrapper::Socket::SocketType socket);
 
+            /**
+             * @brief Retry the output queues left behind by a full socket, must be called from the sending thread
+             */
+            void Flush();
+
+            /**
+             * @brief Check if some output queues still hold bytes the kernel did not accept
+             *
+             * @return True if a later call to Flush is needed, false otherwise
+             */
+            bool HasPending() const;
+
         private:
             /**
              * @struct Header
@@ -51,6 +77,70 @@ namespace Network::Protocol
                 std::uint32_t length; /*!< The length of the message body */
             };
 
+            /**
+             * @struct Stream
+             * @brief Bytes received from a client that do not form a complete message yet.
+             */
+            struct Stream {
+                std::vector<std::uint8_t> data; /*!< The reassembly buffer */
+                std::size_t begin = 0; /*!< Offset of the first byte not yet parsed */
+                std::size_t end = 0; /*!< Offset one past the last received byte */
+            };
+
+            /**
+             * @struct Frame
+             * @brief A message waiting to be written to a client.
+             */
+            struct Frame {
+                std::vector<std::uint8_t> header; /*!< The serialized header */
+                std::vector<std::uint8_t> body; /*!< The content of the message */
+            };
+
+            /**
+             * @struct Output
+             * @brief Frames accepted for a client but not fully written yet.
+             */
+            struct Output {
+                std::deque<Frame> frames; /*!< The frames in sending order */
+                std::size_t offset = 0; /*!< Number of bytes of the first frame already written */
+                std::size_t bytes = 0; /*!< Total size of the queued frames */
+            };
+
+            /**
+             * @brief Make room for the next read at the end of a reassembly buffer.
+             *
+             * @param stream The reassembly buffer of the client.
+             */
+            void Reserve(Stream& stream);
+
+            /**
+             * @brief Dispatch every complete message of a reassembly buffer.
+             *
+             * @param socket The client socket the bytes were received from.
+             * @param stream The reassembly buffer of the client.
+             * @return Whether to disconnect the client or not.
+             */
+            bool Extract(const Wrapper::Socket::SocketType socket, Stream& stream);
+
+            /**
+             * @brief Write queued frames to a non-blocking socket until it is empty or full.
+             *
+             * @param socket The client socket to send data to.
+             * @param output The output queue of the client, the written frames are removed from it.
+             * @return False on a socket error, true otherwise.
+             */
+            bool Write(const Wrapper::Socket::SocketType socket, Output& output);
+
+            /**
+             * @brief Disconnect a player whose output grows faster than it is read, the socket is shut down so the
+             * receiving thread notices the hangup and releases it.
+             *
+             * @param socket The client socket.
+             * @param id The unique identifier of the player.
+             * @param output The output queue of the player, dropped by the caller.
+             */
+            void Evict(const Wrapper::Socket::SocketType socket, const std::uint32_t id, const Output& output);
+
             /**
              * @brief Create a message header given its type and length.
              *
@@ -62,9 +152,13 @@ namespace Network::Protocol
             /**
              * @brief Parse the header of a message to extract its type and length.
              *
-             * @param content The header of the message as a vector of bytes.
+             * @param content A pointer to the TCP_HEADER_SIZE bytes of the header.
              * @return A Header structure containing the message type and its length.
              */
-            Header ParseHeader(const std::vector<std::uint8_t>& content);
+            Header ParseHeader(const std::uint8_t* content);
+
+            std::unordered_map<Wrapper::Socket::SocketType, Stream> _streams; /*!< Reassembly buffer of each client, only used by the receiving thread */
+            std::unordered_map<std::uint32_t, Output> _outputs; /*!< Output queue of each player with unsent bytes, only used by the sending thread */
+            std::vector<Wrapper::Socket::BufferType> _buffers; /*!< Buffer descriptors reused by every gathered write */
     };
 }
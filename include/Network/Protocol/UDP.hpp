@@ -8,6 +8,12 @@
 #pragma once
 
 #include "Wrapper/Socket.hpp"
+#include "Wrapper/Batch.hpp"
+#include "Wrapper/Ring.hpp"
+#include "Network/Player.hpp"
+
+#include <memory>
+#include <vector>
 
 /**
  * @namespace Network-Protocol
@@ -30,18 +36,66 @@ namespace Network::Protocol
             UDP(const Wrapper::Socket::SocketType socket);
 
             /**
-             * @brief Receive a message from a client (simple, direct processing)
+             * @brief Wait for messages from the clients and process them
              */
             void ReceiveMessage();
 
             /**
-             * @brief Send a message to a client (simple, direct sending)
+             * @brief Pack the pending messages of a client into bundles and queue them, sent together by the next call to Flush
              *
              * @param socket The client socket to send data to
              */
             void SendMessage(const Wrapper::Socket::SocketType socket);
 
+            /**
+             * @brief Hand the messages queued by SendMessage to the kernel
+             */
+            void Flush();
+
         private:
+            /**
+             * @brief Process a datagram received from a client
+             *
+             * @param endpoint The sender endpoint
+             * @param data A pointer to the first byte of the datagram
+             * @param size The size of the datagram in bytes
+             */
+            void HandleDatagram(const struct sockaddr_in& endpoint, const std::uint8_t* data, const std::size_t size);
+
+            /**
+             * @brief Queue the bundle being built, or its only message in the usual form, and start a new one
+             *
+             * @param player The player the bundle is addressed to
+             */
+            void Seal(const Network::Player& player);
+
+            /**
+             * @brief Split a message too large for a bundle into fragments, each pushed on the reliable channel of the
+             * player, or sent right away if the message is itself a reliable one already resent as a whole
+             *
+             * @param player The player the message is addressed to
+             * @param message The message to split
+             */
+            void Fragment(Network::Player& player, const Network::Player::Message& message);
+
+            /**
+             * @brief Queue a datagram for a player, or send it right away if it does not fit a batch buffer
+             *
+             * @param player The player the datagram is addressed to
+             * @param content The datagram
+             */
+            void Emit(const Network::Player& player, const std::vector<std::uint8_t>& content);
+
             Wrapper::Socket::SocketType _socket; /*!< The socket used for communication */
+            Wrapper::Batch _batch; /*!< Pooled buffers receiving the datagrams */
+            Wrapper::Batch _outgoing; /*!< Pooled buffers holding the datagrams queued by the send thread */
+            std::vector<std::uint8_t> _bundle; /*!< The bundle being built by the send thread */
+            std::size_t _bundled; /*!< The number of messages in the bundle being built */
+            std::uint32_t _sequence; /*!< The sequence number of the last fragmented message */
+#ifdef USE_IO_URING
+            std::vector<Wrapper::Socket::Datagram> _datagrams; /*!< Datagrams received by the ring in the current wakeup */
+            std::unique_ptr<Wrapper::Ring> _receiver; /*!< Ring used by the receive thread, null when falling back to system calls */
+            std::unique_ptr<Wrapper::Ring> _sender; /*!< Ring used by the send thread, null when falling back to system calls */
+#endif
     };
 }
@@ -0,0 +1,94 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Reliable.hpp
+*/
+
+#pragma once
+
+#include "Miscellaneous/Clock.hpp"
+#include "Types.hpp"
+
+#include <cstdint>
+#include <vector>
+#include <deque>
+#include <mutex>
+
+/**
+ * @namespace Network
+ * @brief Contains classes and functions related to network operations.
+ */
+namespace Network
+{
+    /**
+     * @class Reliable
+     * @brief The reliable ordered datagram channel of a player.
+     *
+     * Every message gets a sequence number and is kept until the player acknowledges it. It is sent again on the
+     * following ticks for redundancy, then whenever the resend timeout expires, the player delivers the messages in
+     * sequence order, ignores duplicates and acknowledges the highest sequence number received in order.
+     */
+    class Reliable
+    {
+        public:
+            /**
+             * @brief Create an empty channel.
+             */
+            explicit Reliable();
+
+            /**
+             * @brief Number a message and keep it until it is acknowledged.
+             *
+             * @param type The type of the message.
+             * @param body The content of the message.
+             * @return The body of the REL message carrying it.
+             */
+            std::vector<std::uint8_t> Push(const ActionType type, const std::vector<std::uint8_t>& body);
+
+            /**
+             * @brief Forget the messages received by the player, acknowledgements beyond the latest sequence number
+             * are ignored.
+             *
+             * @param latest The sequence number up to which every message was received by the player.
+             * @param mask Bit i is set if sequence number latest + 1 + i was received.
+             */
+            void Acknowledge(const std::uint32_t latest, const std::uint32_t mask);
+
+            /**
+             * @brief Drop the pending messages and restart the sequence numbers at 1.
+             */
+            void Clear();
+
+            /**
+             * @brief Collect the messages to send again on this tick.
+             *
+             * @param due Vector filled with the bodies of the REL messages to send, cleared first.
+             */
+            void Collect(std::vector<std::vector<std::uint8_t>>& due);
+
+            /**
+             * @brief Check if too many messages are waiting for an acknowledgement.
+             *
+             * @return True if no message can be added, false otherwise.
+             */
+            bool IsFull() const;
+
+        private:
+            /**
+             * @struct Pending
+             * @brief A message not acknowledged yet.
+             */
+            struct Pending {
+                std::uint32_t sequence; /*!< The sequence number of the message */
+                std::vector<std::uint8_t> body; /*!< The body of the REL message */
+                Misc::Clock clock; /*!< Time since the message was last sent */
+                std::uint8_t sends; /*!< Number of times the message was sent */
+            };
+
+            mutable std::mutex _mutex; /*!< Mutex protecting the pending messages */
+
+            std::deque<Pending> _pending; /*!< The messages not acknowledged yet, by sequence number */
+            std::uint32_t _sequence; /*!< The sequence number of the latest message */
+    };
+}
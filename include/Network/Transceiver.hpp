@@ -10,9 +10,11 @@
 #include "Network/Protocol/TCP.hpp"
 #include "Network/Protocol/UDP.hpp"
 #include "Wrapper/Socket.hpp"
+#include "Wrapper/Poller.hpp"
 
 #include <shared_mutex>
 #include <memory>
+#include <vector>
 #include <atomic>
 
 /**
@@ -53,11 +55,12 @@ namespace Network
             void SecureSend(const std::atomic<bool>& running);
 
             /**
-             * @brief Handle UDP receive operations in dedicated thread.
+             * @brief Handle UDP receive operations of one socket of the port group in dedicated thread.
              *
              * @param running Reference to atomic boolean controlling the running state.
+             * @param shard Index of the socket to receive from, lower than GetShardCount.
              */
-            void Receive(const std::atomic<bool>& running);
+            void Receive(const std::atomic<bool>& running, const std::size_t shard);
 
             /**
              * @brief Handle UDP send operations in dedicated thread.
@@ -72,10 +75,24 @@ namespace Network
             Wrapper::Socket::SocketType GetSecureSocket() const;
 
             /**
-             * @brief Get the UDP socket for external access.
+             * @brief Get the UDP socket used to send datagrams for external access.
              */
             Wrapper::Socket::SocketType GetSocket() const;
 
+            /**
+             * @brief Get the number of UDP sockets sharing the server port.
+             *
+             * @return The number of receive threads to start.
+             */
+            std::size_t GetShardCount() const;
+
+            /**
+             * @brief Check if each datagram is steered to the socket matching the processor that received it.
+             *
+             * @return True if receive thread i should run on the processors steered to socket i, false otherwise.
+             */
+            bool IsSteered() const;
+
             /**
              * @brief Get reference to TCP clients list for thread safety.
              */
@@ -87,7 +104,7 @@ namespace Network
              * @brief Structure holding protocol managers.
              */
             struct Managers {
-                std::unique_ptr<Protocol::UDP> udp; /*!< The user datagram protocol manager */
+                std::vector<std::unique_ptr<Protocol::UDP>> udp; /*!< The user datagram protocol manager of each socket, the first one also sends */
                 std::unique_ptr<Protocol::TCP> tcp; /*!< The transmission control protocol manager */
             };
 
@@ -96,7 +113,7 @@ namespace Network
              * @brief Structure holding both TCP and UDP socket descriptors.
              */
             struct Sockets {
-                Wrapper::Socket::SocketType udp; /*!< The user datagram protocol socket */
+                std::vector<Wrapper::Socket::SocketType> udp; /*!< The user datagram protocol sockets bound to the same port */
                 Wrapper::Socket::SocketType tcp; /*!< The transmission control protocol socket */
             };
 
@@ -107,6 +124,13 @@ namespace Network
              */
             std::optional<Wrapper::Socket::SocketType> HandleConnection();
 
+            /**
+             * @brief Refuse a pending connection while the process is out of descriptors, using the spare one.
+             *
+             * @return True if a connection was refused and the next one may be accepted, false if none is pending.
+             */
+            bool RefuseConnection();
+
             /**
              * @brief Handle disconnection of a client.
              *
@@ -124,7 +148,10 @@ namespace Network
 
             std::vector<Wrapper::Socket::PollType> _clients; /*!< List of connected client sockets */
             mutable std::shared_mutex _mutex; /*!< Mutex for thread-safe access to clients list */
+            Wrapper::Poller _poller; /*!< Reactor watching the listening socket and the connected clients */
             Managers _managers; /*!< The protocol managers */
             Sockets _sockets; /*!< The protocol sockets */
+            bool _steered; /*!< Whether datagrams are steered to a socket by the processor that received them */
+            Wrapper::Socket::SocketType _spare; /*!< A descriptor kept in reserve to refuse connections once the process runs out of them */
     };
 }
@@ -85,6 +85,15 @@ namespace Storage::Cache
              */
             void AddPlayerToGame(const std::uint32_t playerId, const std::uint32_t gameId);
 
+            /**
+             * @brief Add a player to game mapping only if the player is not in a game yet
+             *
+             * @param playerId The unique identifier of the player
+             * @param gameId The unique identifier of the game
+             * @return True if the mapping was added, false if the player is already in a game
+             */
+            bool TryAddPlayerToGame(const std::uint32_t playerId, const std::uint32_t gameId);
+
             /**
              * @brief Remove a player from game mapping
              *
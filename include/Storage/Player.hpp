@@ -8,15 +8,15 @@
 #pragma once
 
 #include "Miscellaneous/Singleton.hpp"
+#include "Miscellaneous/Table.hpp"
 #include "Network/Player.hpp"
 #include "Wrapper/Socket.hpp"
 
-#include <unordered_map>
 #include <shared_mutex>
 #include <optional>
 #include <cstdint>
 #include <memory>
-#include <string>
+#include <vector>
 
 /**
  * @namespace Storage
@@ -27,47 +27,19 @@ namespace Storage::Cache
     /**
      * @class Player
      * @brief Caches connected players for quick access
+     *
+     * Players live in a dense vector of slots reused after disconnection. Sockets index a second vector directly and
+     * session identifiers go through an open addressing table, both hold a slot index along with its generation so a
+     * reused slot is never mistaken for the player that held it before.
      */
     class Player : public Misc::Singleton<Player>
     {
         public:
             /**
-             * @typedef AddressToPlayerMap
-             * @brief Type alias for the map of network addresses to player shared pointers for fast UDP lookup
+             * @typedef EndpointToPlayerMap
+             * @brief Type alias for the table of packed network endpoints to player shared pointers for fast UDP lookup
              */
-            using AddressToPlayerMap = std::unordered_map<std::string, std::shared_ptr<Network::Player>>;
-
-            /**
-             * @typedef SocketToPlayerMap
-             * @brief Type alias for the map of socket descriptors to player shared pointers
-             */
-            using SocketToPlayerMap = std::unordered_map<Wrapper::Socket::SocketType, std::shared_ptr<Network::Player>>;
-
-            /**
-             * @typedef IdToPlayerMap
-             * @brief Type alias for the map of session identifiers to player shared pointers
-             */
-            using IdToPlayerMap = std::unordered_map<std::uint32_t, std::shared_ptr<Network::Player>>;
-
-            /**
-             * @typedef IdToSocketMap
-             * @brief Type alias for the map of player identifiers to socket descriptors for fast reverse lookup
-             */
-            using IdToSocketMap = std::unordered_map<std::uint32_t, Wrapper::Socket::SocketType>;
-
-            /**
-             * @brief Get all the connected players by socket
-             *
-             * @return A constant reference to the unordered map of socket descriptors to player shared pointers
-             */
-            const SocketToPlayerMap& GetSocketToPlayerMap() const;
-
-            /**
-             * @brief Get all the connected players by identifier
-             *
-             * @return A constant reference to the unordered map of session identifiers to player shared pointers
-             */
-            const IdToPlayerMap& GetIdToPlayerMap() const;
+            using EndpointToPlayerMap = Misc::Table<std::shared_ptr<Network::Player>>;
 
             /**
              * @brief Get a player by their socket descriptor
@@ -86,13 +58,12 @@ namespace Storage::Cache
             const std::shared_ptr<Network::Player> GetPlayerById(const std::uint32_t id) const;
 
             /**
-             * @brief Get a player by their network address and port
+             * @brief Get a player by their packed network endpoint, without allocating nor contending with other lookups
              *
-             * @param address The IP address of the player to retrieve
-             * @param port The port of the player to retrieve
+             * @param key The endpoint key of the player to retrieve
              * @return A shared pointer to the player if found, nullptr otherwise
              */
-            const std::shared_ptr<Network::Player> GetPlayerByAddress(const std::string& address, const std::uint16_t port) const;
+            const std::shared_ptr<Network::Player> GetPlayerByEndpoint(const Wrapper::Socket::EndpointKey key) const;
 
             /**
              * @brief Get the socket associated with a session identifier
@@ -127,6 +98,26 @@ namespace Storage::Cache
             std::uint32_t RemovePlayer(const Wrapper::Socket::SocketType socket);
 
         private:
+            /**
+             * @struct Handle
+             * @brief Reference to a slot that becomes stale once the slot is released.
+             */
+            struct Handle {
+                std::uint32_t slot = 0; /*!< The index of the slot */
+                std::uint32_t generation = 0; /*!< The generation of the slot when the handle was made, 0 for none */
+            };
+
+            /**
+             * @struct Slot
+             * @brief A connected player and its socket.
+             */
+            struct Slot {
+                std::shared_ptr<Network::Player> player; /*!< The player, null when the slot is unused */
+                Wrapper::Socket::SocketType socket = {}; /*!< The socket descriptor of the player */
+                std::uint32_t id = 0; /*!< The session identifier of the player */
+                std::uint32_t generation = 0; /*!< Incremented on every use and release, odd while the slot is used */
+            };
+
             /**
              * @brief Allow Singleton to access the private constructor and destructor
              */
@@ -142,11 +133,37 @@ namespace Storage::Cache
              */
             ~Player() = default;
 
-            AddressToPlayerMap _addressToPlayer; /*!< Map of connected players by network address for fast udp lookup */
-            SocketToPlayerMap _socketToPlayer; /*!< Map of connected players by socket */
-            IdToPlayerMap _idToPlayer; /*!< Map of connected players by session identifier */
-            IdToSocketMap _idToSocket; /*!< Map of player identifiers to socket descriptors for fast reverse lookup */
+            /**
+             * @brief Get the slot a handle refers to, the caller must hold _mutex
+             *
+             * @param handle The handle to resolve
+             * @return A pointer to the slot, or nullptr if the handle is stale
+             */
+            const Slot* Resolve(const Handle& handle) const;
+
+            /**
+             * @brief Get the slot of the player connected on a socket, the caller must hold _mutex
+             *
+             * @param socket The socket descriptor to look up
+             * @return A pointer to the slot, or nullptr if no player uses the socket
+             */
+            const Slot* FindBySocket(const Wrapper::Socket::SocketType socket) const;
+
+            /**
+             * @brief Get the slot of a player by session identifier, the caller must hold _mutex
+             *
+             * @param id The session identifier to look up
+             * @return A pointer to the slot, or nullptr if no player has the identifier
+             */
+            const Slot* FindById(const std::uint32_t id) const;
+
+            EndpointToPlayerMap _endpointToPlayer; /*!< Table of connected players by network endpoint for fast udp lookup */
+            std::vector<Slot> _slots; /*!< Slots of the connected players */
+            std::vector<std::uint32_t> _free; /*!< Indexes of the unused slots */
+            std::vector<Handle> _sockets; /*!< Handle of the player connected on each socket descriptor */
+            Misc::Table<Handle> _ids; /*!< Handle of each player by session identifier */
 
             mutable std::shared_mutex _mutex; /*!< Shared mutex for thread-safe player access */
+            mutable std::shared_mutex _endpointMutex; /*!< Shared mutex for the endpoint table only, taken after _mutex when both are needed */
     };
 }
@@ -32,7 +32,13 @@ enum class ActionType : std::uint8_t {
     STP = 12, /*!< Stop the game */
     STS = 13, /*!< Shield status update */
     NXT = 14, /*!< Next wave notification */
-    GOD = 15 /*!< Toggle god mode */
+    GOD = 15, /*!< Toggle god mode */
+    BDL = 16, /*!< Several datagram messages packed together */
+    FRG = 17, /*!< A piece of a datagram message too large for a single datagram */
+    ACK = 18, /*!< Acknowledge a position snapshot */
+    ENC = 19, /*!< Negotiate the encoding of entity messages */
+    REL = 20, /*!< A datagram message delivered reliably and in order */
+    PNG = 21 /*!< Measure the round trip time and synchronise the clocks */
 };
 
 /**
@@ -59,6 +65,15 @@ enum class Role : std::uint8_t {
     Player = 1 /*!< Regular player */
 };
 
+/**
+ * @enum Encoding
+ * @brief The encodings of the entity messages a connection can negotiate.
+ */
+enum class Encoding : std::uint8_t {
+    Plain = 0, /*!< Fixed-size fields */
+    Packed = 1 /*!< Bit-packed fields with variable-width identifiers */
+};
+
 /**
  * @enum Direction
  * @brief The possible movement directions for the player.
@@ -71,7 +86,8 @@ enum class Direction : std::uint8_t {
     Right = 4, /*!< Move right */
     Down = 5, /*!< Move down */
     Left = 6, /*!< Move left */
-    Up = 7 /*!< Move up */
+    Up = 7, /*!< Move up */
+    None = 8 /*!< Stop moving */
 };
 
 /**
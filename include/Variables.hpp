@@ -8,6 +8,7 @@
 #pragma once
 
 #include <cstdint>
+#include <array>
 
 /*!< Related to server configuration */
 
@@ -23,18 +24,76 @@ constexpr std::uint8_t SLEEP_DURATION_MS = 16; /*!< Duration to sleep in the mai
 
 constexpr std::uint32_t MAX_TCP_MESSAGE_SIZE = 1024 * 1024 * 50; /*!< Maximum size for messages (50MB) */
 
+constexpr std::uint32_t MAX_TCP_FRAME_SIZE = 1024 * 64; /*!< Maximum body size of a frame received from a client (64KB) */
+
+constexpr std::uint16_t TCP_RECEIVE_CHUNK_SIZE = 4096; /*!< Minimum free space in a reassembly buffer before each read */
+
+constexpr std::uint8_t TCP_MAX_BUFFERS = 64; /*!< Maximum number of buffers handed to a single gathered write */
+
+constexpr std::uint8_t TCP_RETRY_INTERVAL_MS = 5; /*!< Delay before retrying a write to a full socket */
+
+constexpr std::uint32_t MAX_TCP_PENDING_BYTES = 1024 * 1024 * 4; /*!< Maximum unsent bytes for a player before it is evicted (4MB) */
+
+constexpr std::uint16_t MAX_TCP_QUEUE_SIZE = 4096; /*!< Maximum number of messages waiting for a player before it is evicted */
+
+constexpr std::uint16_t MAX_UDP_QUEUE_SIZE = 256; /*!< Maximum number of datagrams waiting for a player, the oldest are dropped beyond */
+
 constexpr std::uint16_t UDP_PACKET_SIZE = 2048; /*!< Size of each udp packet */
 
-constexpr std::uint8_t HEADER_FRAGMENTS_SIZE = 2; /*!< Size of the fragments field in bytes */
+constexpr std::uint8_t UDP_BATCH_SIZE = 64; /*!< Maximum number of datagrams received per system call */
+
+constexpr std::uint16_t UDP_BUNDLE_SIZE = 1200; /*!< Maximum size of a datagram packing several messages, kept under the path MTU */
+
+constexpr std::uint8_t HEADER_FRAGMENTS_SIZE = 2; /*!< Size of the fragment index and count fields in bytes */
 
 constexpr std::uint8_t HEADER_LENGTH_SIZE = 4; /*!< Size of the message length field in bytes */
 
+constexpr std::uint8_t HEADER_BUNDLE_LENGTH_SIZE = 2; /*!< Size of the length field of a bundled message in bytes */
+
+constexpr std::uint8_t HEADER_SEQUENCE_SIZE = 4; /*!< Size of the sequence number of a fragmented message in bytes */
+
 constexpr std::uint8_t HEADER_TYPE_SIZE = 1; /*!< Size of the message type field in bytes */
 
 constexpr std::uint8_t HEADER_ID_SIZE = 4; /*!< Size of the message identifier field in bytes */
 
+constexpr std::uint8_t RELIABLE_ACK_BITS = 32; /*!< Number of sequence numbers before the latest one covered by an acknowledgement mask */
+
+constexpr std::uint8_t RELIABLE_REDUNDANCY = 2; /*!< Number of consecutive ticks a reliable message is sent on before waiting for the resend timeout */
+
+constexpr std::uint16_t RELIABLE_RESEND_MS = 100; /*!< Delay before sending a reliable message again while it is not acknowledged */
+
+constexpr std::uint16_t MAX_RELIABLE_PENDING = 1024; /*!< Maximum number of unacknowledged reliable messages for a player before it is evicted */
+
+constexpr std::uint16_t PING_INTERVAL_MS = 1000; /*!< Interval between latency probes sent to a player in a game */
+
+constexpr std::uint16_t PING_TIMEOUT_MS = 5000; /*!< Delay after which the answer to a latency probe is ignored and the probe counted as lost */
+
+constexpr std::uint8_t LATENCY_SMOOTHING = 8; /*!< Weight divisor of the moving averages of the round trip time and the loss of a player */
+
+constexpr std::uint8_t JITTER_SMOOTHING = 16; /*!< Weight divisor of the moving average of the round trip time variation of a player */
+
+constexpr std::uint8_t PACKED_ENTITY_BITS = 4; /*!< Width of an entity type in a bit-packed message */
+
+constexpr std::uint8_t PACKED_COORDINATE_BITS = 10; /*!< Width of a coordinate in a bit-packed message, enough for the 900 by 600 world */
+
+constexpr std::uint16_t PACKED_COORDINATE_MAX = (1 << PACKED_COORDINATE_BITS) - 1; /*!< Largest coordinate carried by a bit-packed message */
+
+constexpr std::uint8_t PACKED_ID_CLASS_BITS = 2; /*!< Width of the prefix selecting the width of a bit-packed identifier */
+
+constexpr std::array<std::uint8_t, 1 << PACKED_ID_CLASS_BITS> PACKED_ID_WIDTHS = {6, 12, 20, 32}; /*!< Widths of a bit-packed identifier selected by its prefix */
+
 constexpr std::uint8_t POLL_TIMEOUT_MS = 100; /*!< Timeout for poll in milliseconds */
 
+constexpr std::uint16_t MAX_POLL_EVENTS = 1024; /*!< Maximum number of ready sockets handled per reactor wakeup */
+
+constexpr std::uint16_t RING_ENTRIES = 256; /*!< Number of submission entries of an io_uring instance */
+
+constexpr std::uint16_t RING_BUFFER_COUNT = 256; /*!< Number of registered receive buffers, must be a power of two */
+
+constexpr std::uint16_t RING_BUFFER_SIZE = UDP_PACKET_SIZE + 64; /*!< Size of a registered receive buffer, leaving room for the sender endpoint */
+
+constexpr std::uint16_t RING_BUFFER_GROUP = 0; /*!< Identifier of the registered receive buffer group */
+
 constexpr std::uint8_t TCP_HEADER_SIZE = HEADER_TYPE_SIZE + HEADER_LENGTH_SIZE; /*!< Size of the message header (Type + Length) */
 
 /*!< Related to the game logic */
@@ -45,6 +104,22 @@ constexpr std::uint32_t GAME_INACTIVITY_TIMEOUT_MS = 25000; /*!< Time in millise
 
 constexpr std::uint8_t GAME_PROCESS_INTERVAL_MS = 10; /*!< Interval between entity movements */
 
+constexpr std::uint16_t DEFAULT_TICK_RATE = 1000 / GAME_PROCESS_INTERVAL_MS; /*!< Default number of game ticks per second */
+
+constexpr std::uint16_t MAX_TICK_RATE = 1000; /*!< Maximum number of game ticks per second */
+
+constexpr std::uint8_t MAX_CATCHUP_TICKS = 5; /*!< Maximum number of late ticks run back to back before skipping */
+
+constexpr std::uint16_t MAX_WORKER_COUNT = 256; /*!< Maximum number of threads processing the games */
+
+constexpr std::uint16_t MAX_RECEIVER_COUNT = 64; /*!< Maximum number of datagram sockets sharing the server port */
+
+constexpr std::uint8_t GAME_COST_SMOOTHING = 8; /*!< Weight divisor of the moving average of a game tick cost */
+
+constexpr std::uint32_t WORKER_REPORT_INTERVAL_MS = 30000; /*!< Interval between worker utilisation reports */
+
+constexpr std::uint32_t LATENCY_REPORT_INTERVAL_MS = 30000; /*!< Interval between the latency reports of the players of a game */
+
 constexpr std::uint8_t ENTITY_MOVE_INTERVAL_MS = 100; /*!< Interval between entity movements */
 
 constexpr std::uint8_t MAX_SPAWNABLE_ENTITY_VALUE = 9; /*!< Maximum value for spawnable entity types */
@@ -55,6 +130,32 @@ constexpr std::uint8_t MAX_PLAYER_PER_GAMES = 4; /*!< Maximum number of players
 
 constexpr std::uint8_t MIN_PLAYER_PER_GAMES = 2; /*!< Minimum number of players required to start a game */
 
+constexpr std::uint8_t SNAPSHOT_HISTORY_SIZE = 64; /*!< Number of recent position snapshots kept per player as delta baselines */
+
+constexpr std::uint16_t POSITION_RESEND_MS = 100; /*!< Delay before sending positions again to a player that did not acknowledge them */
+
+constexpr std::uint8_t REWIND_HISTORY_SIZE = 64; /*!< Number of recent ticks whose enemy positions are kept to evaluate shots where the shooter saw them */
+
+constexpr std::uint16_t MAX_REWIND_MS = 250; /*!< Longest delay a shot is rewound by, whatever the tick rate */
+
+constexpr std::uint16_t MAX_REWIND_ENTITIES = 256; /*!< Maximum number of enemy positions recorded per tick, the others are not rewound */
+
+constexpr std::uint32_t DEFAULT_POSITION_BANDWIDTH = 1024 * 64; /*!< Default number of position bytes sent to each player per second (64KB) */
+
+constexpr std::uint32_t MAX_POSITION_BANDWIDTH = 1024 * 1024 * 16; /*!< Maximum number of position bytes sent to each player per second (16MB) */
+
+constexpr float PRIORITY_SELF = 8.0f; /*!< Priority gained per tick by the position of the receiving player */
+
+constexpr float PRIORITY_PLAYER = 4.0f; /*!< Priority gained per tick by the position of another player */
+
+constexpr float PRIORITY_THREAT = 3.0f; /*!< Priority gained per tick by the position of an enemy or boss missile */
+
+constexpr float PRIORITY_ENEMY = 2.0f; /*!< Priority gained per tick by the position of an enemy */
+
+constexpr float PRIORITY_MISSILE = 1.5f; /*!< Priority gained per tick by the position of a player missile */
+
+constexpr float PRIORITY_ITEM = 1.0f; /*!< Priority gained per tick by the position of an item */
+
 constexpr std::uint16_t WINDOW_HEIGHT = 600; /*!< Height of the game area */
 
 constexpr std::uint16_t WINDOW_WIDTH = 900; /*!< Width of the game area */
@@ -75,4 +176,6 @@ constexpr std::uint8_t FORCE_MISSILE_DAMAGE = 40; /*!< Damage dealt by player mi
 
 constexpr std::uint8_t MISSILE_MOVE_SPEED = 40; /*!< Speed at which bullets move */
 
-constexpr std::uint8_t PLAYER_MOVE_SPEED = 4; /*!< Speed at which players move */
+constexpr std::uint16_t PLAYER_MOVE_SPEED = 240; /*!< Distance in pixels travelled per second on each axis by a player holding a direction */
+
+constexpr std::uint8_t MAX_MOVE_STEP_MS = 100; /*!< Longest tick duration integrated at once, so a stalled game does not teleport its players */
@@ -0,0 +1,113 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Batch.hpp
+*/
+
+#pragma once
+
+#include "Wrapper/Socket.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace Wrapper
+ * @brief Contains wrapper classes for system-level operations.
+ */
+namespace Wrapper
+{
+    /**
+     * @class Batch
+     * @brief A pool of preallocated datagram buffers received or sent with a single system call.
+     *
+     * Uses recvmmsg and sendmmsg on Linux and falls back to one system call per datagram elsewhere. The buffers are
+     * reused by every call, the received datagrams are only valid until the next one. An instance is either used to
+     * receive or to send, from a single thread.
+     */
+    class Batch
+    {
+        public:
+            /**
+             * @brief Allocate the buffers of the batch.
+             *
+             * @param count The maximum number of datagrams received or sent per call
+             */
+            explicit Batch(const std::size_t count);
+
+            /**
+             * @brief Receive the datagrams already waiting on a socket without blocking.
+             *
+             * @param sock UDP socket descriptor
+             * @return Number of received datagrams, 0 if none is waiting, or -1 on error
+             */
+            std::int32_t Receive(const Socket::SocketType& sock);
+
+            /**
+             * @brief Copy a datagram into the next free buffer, to be sent by the next call to Send.
+             *
+             * @param data The vector of bytes to send
+             * @param endpoint Destination endpoint
+             * @return True if the datagram was queued, false if the batch is full or the datagram is too large
+             */
+            bool Push(const std::vector<std::uint8_t>& data, const struct sockaddr_in& endpoint);
+
+            /**
+             * @brief Send every queued datagram and empty the batch, a datagram that fails to send is skipped.
+             *
+             * @param sock UDP socket descriptor
+             * @return Number of datagrams that failed to send
+             */
+            std::size_t Send(const Socket::SocketType& sock);
+
+            /**
+             * @brief Get the number of datagrams queued for sending.
+             *
+             * @return The number of queued datagrams
+             */
+            std::size_t GetCount() const;
+
+            /**
+             * @brief Get the maximum number of datagrams received per call.
+             *
+             * @return The capacity of the batch
+             */
+            std::size_t GetCapacity() const;
+
+            /**
+             * @brief Get the content of a received datagram.
+             *
+             * @param index The index of the datagram in the last call
+             * @return A pointer to the first byte of the datagram
+             */
+            const std::uint8_t* GetData(const std::size_t index) const;
+
+            /**
+             * @brief Get the size of a received datagram.
+             *
+             * @param index The index of the datagram in the last call
+             * @return The size of the datagram in bytes
+             */
+            std::size_t GetSize(const std::size_t index) const;
+
+            /**
+             * @brief Get the sender endpoint of a received datagram.
+             *
+             * @param index The index of the datagram in the last call
+             * @return The sender endpoint
+             */
+            const struct sockaddr_in& GetEndpoint(const std::size_t index) const;
+
+        private:
+            std::vector<std::uint8_t> _storage; /*!< Memory backing every buffer of the batch */
+            std::vector<struct sockaddr_in> _addresses; /*!< The sender endpoint of each datagram */
+            std::vector<std::size_t> _sizes; /*!< The size of each datagram */
+            std::size_t _count; /*!< The number of datagrams queued for sending */
+#ifdef __linux__
+            std::vector<struct mmsghdr> _headers; /*!< The message headers given to recvmmsg and sendmmsg */
+            std::vector<struct iovec> _vectors; /*!< The buffer descriptor of each message */
+#endif
+    };
+}
@@ -0,0 +1,104 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Poller.hpp
+*/
+
+#pragma once
+
+#include "Wrapper/Socket.hpp"
+
+#ifdef __linux__
+    #include <sys/epoll.h>
+#endif
+
+#include <cstdint>
+#include <vector>
+#include <mutex>
+
+/**
+ * @namespace Wrapper
+ * @brief Contains wrapper classes for system-level operations.
+ */
+namespace Wrapper
+{
+    /**
+     * @class Poller
+     * @brief A readiness reactor where sockets are registered once and only ready sockets are reported.
+     *
+     * Uses epoll on Linux and falls back to poll over the registered sockets elsewhere.
+     */
+    class Poller
+    {
+        public:
+            /**
+             * @struct Event
+             * @brief Readiness reported for a registered socket.
+             */
+            struct Event {
+                Socket::SocketType socket; /*!< The socket that is ready */
+                bool readable; /*!< Whether data or a connection is waiting on the socket */
+                bool hangup; /*!< Whether the socket was closed or errored */
+            };
+
+            /**
+             * @brief Create the poller.
+             */
+            explicit Poller();
+
+            /**
+             * @brief Destroy the poller, the registered sockets are left open.
+             */
+            ~Poller();
+
+            /**
+             * @brief Deleted copy constructor to prevent copying of the poller.
+             *
+             * @param other The other poller to copy from.
+             */
+            Poller(const Poller& other) = delete;
+
+            /**
+             * @brief Deleted assignment operator to prevent assignment of the poller.
+             *
+             * @param other The other poller to assign from.
+             */
+            Poller& operator=(const Poller& other) = delete;
+
+            /**
+             * @brief Register a socket for read readiness, safe to call from any thread.
+             *
+             * @param sock Socket descriptor to register
+             * @param edge True to only be notified when new data arrives, the socket must then be non-blocking and drained
+             * @return True if the socket was registered, false otherwise
+             */
+            bool Add(const Socket::SocketType& sock, const bool edge = false);
+
+            /**
+             * @brief Unregister a socket, must be called before closing it.
+             *
+             * @param sock Socket descriptor to unregister
+             * @return True if the socket was unregistered, false otherwise
+             */
+            bool Remove(const Socket::SocketType& sock);
+
+            /**
+             * @brief Wait for registered sockets to become ready.
+             *
+             * @param events Vector filled with the ready sockets, cleared first
+             * @param timeout Timeout in milliseconds (-1 for infinite wait)
+             * @return Number of ready sockets, 0 on timeout, or -1 on error
+             */
+            std::int32_t Wait(std::vector<Event>& events, std::int32_t timeout);
+
+        private:
+#ifdef __linux__
+            std::int32_t _fd; /*!< The epoll instance */
+            std::vector<struct epoll_event> _buffer; /*!< Preallocated buffer receiving the ready events */
+#else
+            std::vector<Socket::PollType> _sockets; /*!< The registered sockets */
+            std::mutex _mutex; /*!< Mutex protecting the registered sockets */
+#endif
+    };
+}
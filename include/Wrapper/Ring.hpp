@@ -0,0 +1,181 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Ring.hpp
+*/
+
+#pragma once
+
+#ifdef USE_IO_URING
+
+#include "Wrapper/Socket.hpp"
+
+#include <linux/io_uring.h>
+
+#include <cstdint>
+#include <vector>
+#include <atomic>
+
+/**
+ * @namespace Wrapper
+ * @brief Contains wrapper classes for system-level operations.
+ */
+namespace Wrapper
+{
+    /**
+     * @class Ring
+     * @brief An io_uring instance batching datagram operations on a single socket.
+     *
+     * Receives use one multishot recvmsg backed by a ring of registered buffers, sends are queued and submitted
+     * together on Flush. A ring is not thread-safe, each thread must use its own.
+     */
+    class Ring
+    {
+        public:
+            /**
+             * @brief Create the ring, throw if the kernel does not support the required features.
+             *
+             * @param sock The datagram socket the ring operates on
+             */
+            explicit Ring(const Socket::SocketType& sock);
+
+            /**
+             * @brief Destroy the ring and unmap its memory.
+             */
+            ~Ring();
+
+            /**
+             * @brief Deleted copy constructor to prevent copying of the ring.
+             *
+             * @param other The other ring to copy from.
+             */
+            Ring(const Ring& other) = delete;
+
+            /**
+             * @brief Deleted assignment operator to prevent assignment of the ring.
+             *
+             * @param other The other ring to assign from.
+             */
+            Ring& operator=(const Ring& other) = delete;
+
+            /**
+             * @brief Wait for datagrams, arming the multishot receive if needed.
+             *
+             * @param datagrams Vector filled with the received datagrams, cleared first
+             * @param timeout Timeout in milliseconds
+             * @return Number of received datagrams, or -1 on error or when the kernel rejects the multishot receive
+             */
+            std::int32_t ReceiveFrom(std::vector<Socket::Datagram>& datagrams, std::int32_t timeout);
+
+            /**
+             * @brief Queue a datagram to be sent on the next flush.
+             *
+             * @param data The vector of bytes to send
+             * @param endpoint Destination endpoint
+             * @return True if the datagram was queued, false otherwise
+             */
+            bool SendTo(const std::vector<std::uint8_t>& data, const struct sockaddr_in& endpoint);
+
+            /**
+             * @brief Submit every queued operation with a single system call and reap finished sends.
+             *
+             * @return Number of submitted operations, or -1 on error
+             */
+            std::int32_t Flush();
+
+        private:
+            /**
+             * @struct Slot
+             * @brief A pending send, kept alive until its completion is reaped.
+             */
+            struct Slot {
+                struct msghdr header; /*!< The message header given to the kernel */
+                struct iovec vector; /*!< The payload descriptor */
+                struct sockaddr_in address; /*!< The destination endpoint */
+                std::vector<std::uint8_t> data; /*!< The payload */
+            };
+
+            /**
+             * @enum Operation
+             * @brief Tag stored in the completion user data to route completions.
+             */
+            enum class Operation : std::uint8_t {
+                Receive = 1, /*!< Multishot datagram receive */
+                Send = 2 /*!< Datagram send, the low bits hold the slot index */
+            };
+
+            /**
+             * @brief Unmap the ring memory and close the instance.
+             */
+            void Release();
+
+            /**
+             * @brief Access an index shared with the kernel in a mapped ring.
+             *
+             * @param ring The mapped ring
+             * @param offset The offset of the index given by the kernel
+             * @return An atomic reference to the index
+             */
+            static std::atomic_ref<std::uint32_t> Field(std::uint8_t* ring, const std::uint32_t offset);
+
+            /**
+             * @brief Get a free submission entry, the kernel only reads it on the next Enter.
+             *
+             * @return The entry, or nullptr if the submission queue is full
+             */
+            struct io_uring_sqe* GetEntry();
+
+            /**
+             * @brief Arm the multishot receive on the socket.
+             */
+            void Arm();
+
+            /**
+             * @brief Hand a receive buffer back to the kernel.
+             *
+             * Entries are indexed from the start of the ring, the bufs flexible array of the kernel header is shifted
+             * by its empty placeholder member when compiled as C++.
+             *
+             * @param index The index of the buffer
+             */
+            void Recycle(const std::uint16_t index);
+
+            /**
+             * @brief Enter the kernel to submit queued entries and optionally wait for completions.
+             *
+             * @param wait Minimum number of completions to wait for
+             * @param timeout Timeout in milliseconds when waiting, -1 for infinite wait
+             * @return The result of the system call
+             */
+            std::int32_t Enter(const std::uint32_t wait, const std::int32_t timeout);
+
+            /**
+             * @brief Consume every available completion.
+             *
+             * @param datagrams Vector receiving the payload of receive completions
+             */
+            void Reap(std::vector<Socket::Datagram>& datagrams);
+
+            Socket::SocketType _socket; /*!< The datagram socket */
+            std::int32_t _fd; /*!< The io_uring instance */
+            struct io_uring_params _params; /*!< The parameters returned by the kernel */
+
+            std::uint8_t* _sqRing; /*!< The mapped submission queue ring */
+            std::uint8_t* _cqRing; /*!< The mapped completion queue ring */
+            struct io_uring_sqe* _entries; /*!< The mapped submission entries */
+            std::size_t _size; /*!< The size of the mapping shared by both queues */
+            std::uint32_t _pending; /*!< Entries written but not yet submitted */
+
+            struct io_uring_buf_ring* _buffers; /*!< The registered receive buffer ring */
+            std::vector<std::uint8_t> _storage; /*!< Memory backing the receive buffers */
+            struct msghdr _header; /*!< Template of the multishot receive, only the name length is used */
+            bool _armed; /*!< Whether the multishot receive is active */
+            std::int32_t _error; /*!< The error that ended the multishot receive, 0 if none or out of buffers */
+
+            std::vector<Slot> _slots; /*!< Storage of the pending sends */
+            std::vector<std::uint32_t> _free; /*!< Indexes of the unused send slots */
+    };
+}
+
+#endif
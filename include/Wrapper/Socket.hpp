@@ -11,10 +11,16 @@
     #include <winsock2.h>
     #include <ws2tcpip.h>
 #else
+#ifdef __linux__
+    #include <linux/filter.h>
+#endif
+    #include <netinet/tcp.h>
     #include <sys/socket.h>
     #include <netinet/in.h>
+    #include <sys/uio.h>
     #include <arpa/inet.h>
     #include <unistd.h>
+    #include <fcntl.h>
     #include <poll.h>
 #endif
 
@@ -59,6 +65,12 @@ namespace Wrapper
              * @brief Type alias for poll structure on Windows systems
              */
             using PollType = WSAPOLLFD;
+
+            /**
+             * @typedef BufferType
+             * @brief Type alias for gathered write buffer descriptor on Windows systems
+             */
+            using BufferType = WSABUF;
 #else
             /**
              * @typedef SocketType
@@ -77,6 +89,12 @@ namespace Wrapper
              * @brief Type alias for poll structure on Unix systems
              */
             using PollType = struct pollfd;
+
+            /**
+             * @typedef BufferType
+             * @brief Type alias for gathered write buffer descriptor on Unix systems
+             */
+            using BufferType = struct iovec;
 #endif
 
             /**
@@ -88,6 +106,21 @@ namespace Wrapper
                 UDP /*!< We use user datagram protocol */
             };
 
+            /**
+             * @struct Datagram
+             * @brief A datagram received on a socket along with its sender endpoint.
+             */
+            struct Datagram {
+                struct sockaddr_in endpoint; /*!< Sender endpoint */
+                std::vector<std::uint8_t> data; /*!< The content of the datagram */
+            };
+
+            /**
+             * @typedef EndpointKey
+             * @brief An IPv4 address and a port packed in a single integer, in host byte order
+             */
+            using EndpointKey = std::uint64_t;
+
             /**
              * @brief Initialize the socket library (needed for Windows)
              * @return True if initialization succeeded, false otherwise
@@ -123,6 +156,14 @@ namespace Wrapper
              */
             static bool Close(const SocketType& sock);
 
+            /**
+             * @brief Stop both directions of a connected socket without releasing its descriptor
+             *
+             * @param sock Socket descriptor to shut down
+             * @return True if the socket was shut down successfully, false otherwise
+             */
+            static bool Shutdown(const SocketType& sock);
+
             /**
              * @brief Connect to a remote server
              *
@@ -169,6 +210,45 @@ namespace Wrapper
              */
             static bool SetReuse(const SocketType& sock, bool reuse = true);
 
+            /**
+             * @brief Set the socket in non-blocking mode
+             *
+             * @param sock Socket descriptor
+             * @param enable True to make operations return immediately, false to make them block
+             * @return True if the mode was changed successfully, false otherwise
+             */
+            static bool SetNonBlocking(const SocketType& sock, bool enable = true);
+
+            /**
+             * @brief Spread the datagrams of a port group over its sockets by the processor that received them
+             *
+             * Attaches a classic BPF program returning the current processor modulo the group size, so the datagrams
+             * handled by a processor always land on the same socket. Only available on Linux.
+             *
+             * @param sock Any socket of the group, bound with address reuse
+             * @param count The number of sockets in the group
+             * @return True if the program was attached, false otherwise
+             */
+            static bool SetSteering(const SocketType& sock, std::uint32_t count);
+
+            /**
+             * @brief Disable Nagle's algorithm so written frames leave without waiting for acknowledgements
+             *
+             * @param sock Socket descriptor
+             * @param enable True to send segments immediately, false to let the kernel delay small ones
+             * @return True if the option was set successfully, false otherwise
+             */
+            static bool SetNoDelay(const SocketType& sock, bool enable = true);
+
+            /**
+             * @brief Describe a memory area to be sent by a gathered write
+             *
+             * @param data Pointer to the first byte
+             * @param size Number of bytes
+             * @return The buffer descriptor
+             */
+            static BufferType MakeBuffer(const std::uint8_t* data, std::size_t size);
+
             /**
              * @brief Send data over transmission control protocol
              *
@@ -178,6 +258,15 @@ namespace Wrapper
              */
             static TransmitType Send(const SocketType& sock, const std::vector<std::uint8_t>& data);
 
+            /**
+             * @brief Send several memory areas over transmission control protocol with a single system call
+             *
+             * @param sock Socket descriptor
+             * @param buffers The buffer descriptors, sent in order
+             * @return Number of bytes sent or -1 on error
+             */
+            static TransmitType Send(const SocketType& sock, std::vector<BufferType>& buffers);
+
             /**
              * @brief Receive data over transmission control protocol
              *
@@ -187,6 +276,16 @@ namespace Wrapper
              */
             static std::vector<std::uint8_t> Receive(const SocketType& sock, std::size_t size);
 
+            /**
+             * @brief Receive data over transmission control protocol into an existing buffer
+             *
+             * @param sock Socket descriptor
+             * @param buffer Pointer to the memory receiving the data
+             * @param size Maximum number of bytes to receive
+             * @return Number of bytes received, 0 if the peer closed the connection or -1 on error
+             */
+            static TransmitType Receive(const SocketType& sock, std::uint8_t* buffer, std::size_t size);
+
             /**
              * @brief Poll a set of sockets for events
              *
@@ -217,10 +316,56 @@ namespace Wrapper
              */
             static TransmitType SendTo(const SocketType& sock, const std::vector<std::uint8_t>& data, const std::string& address, std::uint16_t port);
 
+            /**
+             * @brief Send data to an already resolved endpoint using a datagram socket
+             *
+             * @param sock UDP socket to send from
+             * @param data The vector of bytes to send
+             * @param endpoint Destination endpoint
+             * @return Number of bytes sent or -1 on error
+             */
+            static TransmitType SendTo(const SocketType& sock, const std::vector<std::uint8_t>& data, const struct sockaddr_in& endpoint);
+
+            /**
+             * @brief Resolve an IPv4 address and a port into an endpoint
+             *
+             * @param address IPv4 address as string
+             * @param port The port
+             * @param endpoint Reference to the endpoint to fill
+             * @return True if the address is valid, false otherwise
+             */
+            static bool ToEndpoint(const std::string& address, std::uint16_t port, struct sockaddr_in& endpoint);
+
+            /**
+             * @brief Pack an endpoint into a key usable for lookups without any allocation
+             *
+             * @param endpoint The resolved endpoint
+             * @return The address in the upper bits and the port in the lower 16 bits
+             */
+            static EndpointKey ToKey(const struct sockaddr_in& endpoint);
+
             /**
              * @brief Get the last socket error as a string
              * @return Error message
              */
             static std::string GetLastError();
+
+            /**
+             * @brief Check if the last socket error means a non-blocking operation would have blocked
+             * @return True if the operation must be retried once the socket is ready, false otherwise
+             */
+            static bool WouldBlock();
+
+            /**
+             * @brief Check if the last socket error means a blocking call was interrupted by a signal
+             * @return True if the call can simply be made again, false otherwise
+             */
+            static bool IsInterrupted();
+
+            /**
+             * @brief Check if the last socket error means the process or the system ran out of descriptors
+             * @return True if no socket can be created until another one is closed, false otherwise
+             */
+            static bool IsExhausted();
     };
 }
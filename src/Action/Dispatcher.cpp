@@ -6,15 +6,18 @@
 */
 
 #include "Action/Dispatcher.hpp"
+#include "Action/List/ACK.hpp"
 #include "Action/List/CRE.hpp"
 #include "Action/List/DFY.hpp"
 #include "Action/List/DIE.hpp"
+#include "Action/List/ENC.hpp"
 #include "Action/List/ERR.hpp"
 #include "Action/List/GOD.hpp"
 #include "Action/List/JON.hpp"
 #include "Action/List/LVE.hpp"
 #include "Action/List/NXT.hpp"
 #include "Action/List/OVE.hpp"
+#include "Action/List/PNG.hpp"
 #include "Action/List/POS.hpp"
 #include "Action/List/STS.hpp"
 #include "Action/List/SHT.hpp"
@@ -45,15 +48,18 @@ Action::IAction* Action::Dispatcher::GetAction(const ActionType type)
     static const std::unordered_map<ActionType, std::unique_ptr<Action::IAction>> actions = []() {
         std::unordered_map<ActionType, std::unique_ptr<Action::IAction>> elements = {};
 
+        elements[ActionType::ACK] = std::make_unique<Action::List::ACK>();
         elements[ActionType::CRE] = std::make_unique<Action::List::CRE>();
         elements[ActionType::DFY] = std::make_unique<Action::List::DFY>();
         elements[ActionType::DIE] = std::make_unique<Action::List::DIE>();
+        elements[ActionType::ENC] = std::make_unique<Action::List::ENC>();
         elements[ActionType::ERR] = std::make_unique<Action::List::ERR>();
         elements[ActionType::GOD] = std::make_unique<Action::List::GOD>();
         elements[ActionType::JON] = std::make_unique<Action::List::JON>();
         elements[ActionType::LVE] = std::make_unique<Action::List::LVE>();
         elements[ActionType::NXT] = std::make_unique<Action::List::NXT>();
         elements[ActionType::OVE] = std::make_unique<Action::List::OVE>();
+        elements[ActionType::PNG] = std::make_unique<Action::List::PNG>();
         elements[ActionType::POS] = std::make_unique<Action::List::POS>();
         elements[ActionType::STS] = std::make_unique<Action::List::STS>();
         elements[ActionType::SHT] = std::make_unique<Action::List::SHT>();
@@ -0,0 +1,61 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ACK.cpp
+*/
+
+#include "Miscellaneous/Logger.hpp"
+#include "Miscellaneous/Utils.hpp"
+#include "Exception/Generic.hpp"
+#include "Action/List/ACK.hpp"
+#include "Storage/Player.hpp"
+#include "Storage/Game.hpp"
+#include "Variables.hpp"
+#include "Types.hpp"
+
+#include <format>
+
+void Action::List::ACK::ReceiveMessage(const std::uint32_t id, const std::vector<std::uint8_t>& body)
+{
+    try {
+        const std::shared_ptr<Network::Player>& player = Storage::Cache::Player::GetInstance().GetPlayerById(id);
+        const std::optional<std::string> connectedValidation = ValidatePlayer(player, PlayerValidation::Connected);
+
+        if (connectedValidation.has_value()) {
+            throw Exception::GenericError(connectedValidation.value());
+        } else if (body.size() != HEADER_SEQUENCE_SIZE && body.size() != 3 * HEADER_SEQUENCE_SIZE) {
+            throw Exception::GenericError(std::format("Expected body size {} or {}, got {}", HEADER_SEQUENCE_SIZE, 3 * HEADER_SEQUENCE_SIZE, body.size()));
+        }
+
+        const std::uint32_t snapshot = Misc::Utils::Deserialize<std::uint32_t>(body);
+
+        if (body.size() > HEADER_SEQUENCE_SIZE) {
+            player->AcknowledgeReliable(Misc::Utils::Deserialize<std::uint32_t>(body, HEADER_SEQUENCE_SIZE), Misc::Utils::Deserialize<std::uint32_t>(body, 2 * HEADER_SEQUENCE_SIZE));
+        }
+        if (snapshot == 0) {
+            return;
+        }
+
+        const std::optional<std::string> playerValidation = ValidatePlayer(player, PlayerValidation::Playing);
+
+        if (playerValidation.has_value()) {
+            throw Exception::GenericError(playerValidation.value());
+        }
+
+        const std::shared_ptr<Engine::Game>& game = Storage::Cache::Game::GetInstance().GetGameByPlayerId(id);
+        const std::optional<std::string> gameValidation = ValidateGame(game, GameValidation::Started);
+
+        if (gameValidation.has_value()) {
+            throw Exception::GenericError(gameValidation.value());
+        }
+
+        game->Push({ .type = Engine::Game::Command::Type::Acknowledge, .player = id, .value = snapshot });
+    } catch (const Exception::GenericError& ex) {
+        Misc::Logger::Log(std::format("Failed to process ACK for player {}: {}", id, ex.what()), Misc::Logger::LogLevel::Critical);
+    } catch (const std::exception& ex) {
+        Misc::Logger::Log(std::format("Failed to process ACK for player {}: {}", id, ex.what()), Misc::Logger::LogLevel::Critical);
+    } catch (...) {
+        Misc::Logger::Log(std::format("Failed to process ACK for player {}", id), Misc::Logger::LogLevel::Critical);
+    }
+}
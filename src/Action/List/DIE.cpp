@@ -13,6 +13,7 @@
 #include "Variables.hpp"
 
 #include <cstdint>
+#include <algorithm>
 #include <format>
 
 void Action::List::DIE::SendMessage(const std::uint32_t id, const std::any& content) const
@@ -29,9 +30,18 @@ void Action::List::DIE::SendMessage(const std::uint32_t id, const std::any& cont
         if (entityType > MAX_ENTITY_VALUE) {
             throw Exception::GenericError(std::format("Entity type is out of range, got {}", entityType));
         }
-        const std::vector<std::uint8_t> serialized = Misc::Utils::Serialize(entityId, entityType);
+        std::vector<std::uint8_t> serialized = {};
 
-        player->PushMessage(Wrapper::Socket::Protocol::UDP, {
+        if (player->GetEncoding() == Encoding::Packed) {
+            std::size_t offset = 0;
+
+            Misc::Utils::WriteId(serialized, offset, entityId);
+            Misc::Utils::WriteBits(serialized, offset, entityType, PACKED_ENTITY_BITS);
+        } else {
+            serialized = Misc::Utils::Serialize(entityId, entityType);
+        }
+
+        player->PushReliable({
             .type = ActionType::DIE,
             .body = serialized
         });
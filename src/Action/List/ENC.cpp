@@ -0,0 +1,66 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ENC.cpp
+*/
+
+#include "Miscellaneous/Logger.hpp"
+#include "Miscellaneous/Utils.hpp"
+#include "Exception/Generic.hpp"
+#include "Action/Dispatcher.hpp"
+#include "Action/List/ENC.hpp"
+#include "Storage/Player.hpp"
+#include "Types.hpp"
+
+#include <format>
+
+void Action::List::ENC::ReceiveMessage(const std::uint32_t id, const std::vector<std::uint8_t>& body)
+{
+    try {
+        const std::shared_ptr<Network::Player>& player = Storage::Cache::Player::GetInstance().GetPlayerById(id);
+        const std::optional<std::string> playerValidation = ValidatePlayer(player, PlayerValidation::Connected | PlayerValidation::NotPlaying);
+
+        if (playerValidation.has_value()) {
+            throw Exception::GenericError(playerValidation.value());
+        } else if (body.size() != 1) {
+            throw Exception::GenericError(std::format("Expected body size 1, got {}", body.size()));
+        } else if (body[0] > Misc::Utils::GetEnumIndex(Encoding::Packed)) {
+            throw Exception::GenericError(std::format("Unknown encoding, got {}", body[0]));
+        }
+
+        player->SetEncoding(static_cast<Encoding>(body[0]));
+        Action::Dispatcher::SendMessage(ActionType::ENC, id, player->GetEncoding());
+    } catch (const Exception::GenericError& ex) {
+        Misc::Logger::Log(std::format("Failed to process ENC from player {}: {}", id, ex.what()), Misc::Logger::LogLevel::Critical);
+    } catch (const std::exception& ex) {
+        Misc::Logger::Log(std::format("Failed to process ENC from player {}: {}", id, ex.what()), Misc::Logger::LogLevel::Critical);
+    } catch (...) {
+        Misc::Logger::Log(std::format("Failed to process ENC from player {}", id), Misc::Logger::LogLevel::Critical);
+    }
+}
+
+void Action::List::ENC::SendMessage(const std::uint32_t id, const std::any& content) const
+{
+    try {
+        const std::shared_ptr<Network::Player>& player = Storage::Cache::Player::GetInstance().GetPlayerById(id);
+        const std::optional<std::string> playerValidation = ValidatePlayer(player, PlayerValidation::Connected);
+
+        if (playerValidation.has_value()) {
+            throw Exception::GenericError(playerValidation.value());
+        }
+
+        const Encoding encoding = std::any_cast<Encoding>(content);
+
+        player->PushMessage(Wrapper::Socket::Protocol::TCP, {
+            .type = ActionType::ENC,
+            .body = { Misc::Utils::GetEnumIndex(encoding) }
+        });
+    } catch (const Exception::GenericError& ex) {
+        Misc::Logger::Log(std::format("Failed to send ENC to player {}: {}", id, ex.what()), Misc::Logger::LogLevel::Critical);
+    } catch (const std::exception& ex) {
+        Misc::Logger::Log(std::format("Failed to send ENC to player {}: {}", id, ex.what()), Misc::Logger::LogLevel::Critical);
+    } catch (...) {
+        Misc::Logger::Log(std::format("Failed to send ENC to player {}", id), Misc::Logger::LogLevel::Critical);
+    }
+}
@@ -32,11 +32,7 @@ void Action::List::GOD::ReceiveMessage(const std::uint32_t id, const std::vector
             throw Exception::GenericError(gameValidation.value());
         }
 
-        if (player->IsStatisticActive(Statistic::Shield)) {
-            game->SetPlayerIdStatistic(player, Statistic::Shield, false, true);
-        } else {
-            game->SetPlayerIdStatistic(player, Statistic::Shield, true, true);
-        }
+        game->Push({ .type = Engine::Game::Command::Type::God, .player = id, .value = 0 });
     } catch (const Exception::GenericError& ex) {
         Misc::Logger::Log(std::format("Failed to process GOD from player {}: {}", id, ex.what()), Misc::Logger::LogLevel::Critical);
     } catch (const std::exception& ex) {
@@ -34,9 +34,7 @@ void Action::List::JON::ReceiveMessage(const std::uint32_t id, const std::vector
             throw Exception::GenericError(gameValidation.value());
         }
 
-        if (game->AddPlayerId(id)) {
-            Storage::Cache::Game::GetInstance().AddPlayerToGame(id, gameId);
-        }
+        game->Push({ .type = Engine::Game::Command::Type::Join, .player = id, .value = 0 });
     } catch (const Exception::GenericError& ex) {
         Misc::Logger::Log(std::format("Failed to process JON from player {}: {}", id, ex.what()), Misc::Logger::LogLevel::Critical);
     } catch (const std::exception& ex) {
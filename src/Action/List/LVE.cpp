@@ -31,9 +31,7 @@ void Action::List::LVE::ReceiveMessage(const std::uint32_t id, const std::vector
             throw Exception::GenericError(gameValidation.value());
         }
 
-        if (game->RemovePlayerId(id)) {
-            Storage::Cache::Game::GetInstance().RemovePlayerFromGame(id);
-        }
+        game->Push({ .type = Engine::Game::Command::Type::Leave, .player = id, .value = 0 });
     } catch (const Exception::GenericError& ex) {
         Misc::Logger::Log(std::format("Failed to process LVE from player {}: {}", id, ex.what()), Misc::Logger::LogLevel::Critical);
     } catch (const std::exception& ex) {
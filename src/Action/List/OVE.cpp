@@ -11,6 +11,7 @@
 #include "Action/List/OVE.hpp"
 #include "Storage/Player.hpp"
 #include "Storage/Game.hpp"
+#include "Variables.hpp"
 #include "Types.hpp"
 
 #include <format>
@@ -23,8 +24,10 @@ void Action::List::OVE::ReceiveMessage(const std::uint32_t id, const std::vector
 
         if (playerValidation.has_value()) {
             throw Exception::GenericError(playerValidation.value());
-        } else if (body.size() != 1) {
-            throw Exception::GenericError(std::format("Expected body size 1, got {}", body.size()));
+        } else if (body.size() != 1 && body.size() != 1 + HEADER_SEQUENCE_SIZE) {
+            throw Exception::GenericError(std::format("Expected body size 1 or {}, got {}", 1 + HEADER_SEQUENCE_SIZE, body.size()));
+        } else if (body[0] > Misc::Utils::GetEnumIndex(Direction::None)) {
+            throw Exception::GenericError(std::format("Unknown direction, got {}", body[0]));
         }
 
         const std::shared_ptr<Engine::Game>& game = Storage::Cache::Game::GetInstance().GetGameByPlayerId(id);
@@ -34,10 +37,12 @@ void Action::List::OVE::ReceiveMessage(const std::uint32_t id, const std::vector
             throw Exception::GenericError(gameValidation.value());
         }
 
-        const Direction direction = static_cast<Direction>(body[0]);
-        const Position position = player->Move(direction);
-
-        game->QueuePosition(id, Misc::Utils::GetEnumIndex(Character::Player), position);
+        game->Push({
+            .type = Engine::Game::Command::Type::Move,
+            .player = id,
+            .value = body[0],
+            .sequence = body.size() > 1 ? Misc::Utils::Deserialize<std::uint32_t>(body, 1) : 0
+        });
     } catch (const Exception::GenericError& ex) {
         Misc::Logger::Log(std::format("Failed to process OVE for player {}: {}", id, ex.what()), Misc::Logger::LogLevel::Critical);
     } catch (const std::exception& ex) {
@@ -0,0 +1,48 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** PNG.cpp
+*/
+
+#include "Miscellaneous/Logger.hpp"
+#include "Miscellaneous/Utils.hpp"
+#include "Exception/Generic.hpp"
+#include "Action/List/PNG.hpp"
+#include "Network/Player.hpp"
+#include "Storage/Player.hpp"
+#include "Variables.hpp"
+#include "Types.hpp"
+
+#include <format>
+
+void Action::List::PNG::ReceiveMessage(const std::uint32_t id, const std::vector<std::uint8_t>& body)
+{
+    try {
+        const std::shared_ptr<Network::Player>& player = Storage::Cache::Player::GetInstance().GetPlayerById(id);
+        const std::optional<std::string> playerValidation = ValidatePlayer(player, PlayerValidation::Connected);
+
+        if (playerValidation.has_value()) {
+            throw Exception::GenericError(playerValidation.value());
+        } else if (body.size() != HEADER_SEQUENCE_SIZE + sizeof(std::uint64_t)) {
+            throw Exception::GenericError(std::format("Expected body size {}, got {}", HEADER_SEQUENCE_SIZE + sizeof(std::uint64_t), body.size()));
+        }
+
+        const std::uint32_t sequence = Misc::Utils::Deserialize<std::uint32_t>(body);
+
+        if (!player->RecordPing(sequence, Misc::Utils::Deserialize<std::uint64_t>(body, HEADER_SEQUENCE_SIZE))) {
+            Misc::Logger::Log(std::format("Ignored late or unknown probe {} from player {}", sequence, id), Misc::Logger::LogLevel::Network);
+            return;
+        }
+
+        const Network::Latency::Estimate latency = player->GetLatency();
+
+        Misc::Logger::Log(std::format("Player {}: {:.1f} ms round trip, {:.1f} ms jitter, {:.1f}% loss", id, latency.rtt, latency.jitter, latency.loss * 100.0f), Misc::Logger::LogLevel::Network);
+    } catch (const Exception::GenericError& ex) {
+        Misc::Logger::Log(std::format("Failed to process PNG for player {}: {}", id, ex.what()), Misc::Logger::LogLevel::Critical);
+    } catch (const std::exception& ex) {
+        Misc::Logger::Log(std::format("Failed to process PNG for player {}: {}", id, ex.what()), Misc::Logger::LogLevel::Critical);
+    } catch (...) {
+        Misc::Logger::Log(std::format("Failed to process PNG for player {}", id), Misc::Logger::LogLevel::Critical);
+    }
+}
@@ -11,6 +11,7 @@
 #include "Storage/Player.hpp"
 
 #include <cstdint>
+#include <algorithm>
 #include <format>
 
 void Action::List::POS::SendMessage(const std::uint32_t id, const std::any& content) const
@@ -23,13 +24,23 @@ void Action::List::POS::SendMessage(const std::uint32_t id, const std::any& cont
             throw Exception::GenericError(playerValidation.value());
         }
 
-        const auto& positions = std::any_cast<const std::vector<std::tuple<std::uint32_t, std::uint8_t, Position>>&>(content);
-        std::vector<std::uint8_t> serialized = Misc::Utils::Serialize<std::uint16_t>(static_cast<std::uint16_t>(positions.size()));
+        const auto& [sequence, baseline, input, positions] = std::any_cast<const std::tuple<std::uint32_t, std::uint32_t, std::uint32_t, std::vector<std::tuple<std::uint32_t, std::uint8_t, Position>>>&>(content);
+        std::vector<std::uint8_t> serialized = Misc::Utils::Serialize(sequence, baseline, input, static_cast<std::uint16_t>(positions.size()));
+
+        const bool packed = player->GetEncoding() == Encoding::Packed;
+        std::size_t offset = serialized.size() * 8;
 
         for (const auto& [entityId, entityType, position] : positions) {
             if (entityType > MAX_ENTITY_VALUE) {
                 throw Exception::GenericError(std::format("Entity type is out of range, got {}", entityType));
             }
+            if (packed) {
+                Misc::Utils::WriteId(serialized, offset, entityId);
+                Misc::Utils::WriteBits(serialized, offset, entityType, PACKED_ENTITY_BITS);
+                Misc::Utils::WriteBits(serialized, offset, std::min(position.x, PACKED_COORDINATE_MAX), PACKED_COORDINATE_BITS);
+                Misc::Utils::WriteBits(serialized, offset, std::min(position.y, PACKED_COORDINATE_MAX), PACKED_COORDINATE_BITS);
+                continue;
+            }
             std::vector<std::uint8_t> update = Misc::Utils::Serialize(entityId, entityType, position);
             serialized.insert(serialized.end(), update.begin(), update.end());
         }
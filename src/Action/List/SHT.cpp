@@ -6,16 +6,18 @@
 */
 
 #include "Miscellaneous/Logger.hpp"
+#include "Miscellaneous/Utils.hpp"
 #include "Exception/Generic.hpp"
 #include "Action/List/SHT.hpp"
 #include "Network/Player.hpp"
 #include "Storage/Player.hpp"
 #include "Storage/Game.hpp"
+#include "Variables.hpp"
 #include "Types.hpp"
 
 #include <format>
 
-void Action::List::SHT::ReceiveMessage(const std::uint32_t id, const std::vector<std::uint8_t>&)
+void Action::List::SHT::ReceiveMessage(const std::uint32_t id, const std::vector<std::uint8_t>& body)
 {
     try {
         const std::shared_ptr<Network::Player>& player = Storage::Cache::Player::GetInstance().GetPlayerById(id);
@@ -23,6 +25,8 @@ void Action::List::SHT::ReceiveMessage(const std::uint32_t id, const std::vector
 
         if (playerValidation.has_value()) {
             throw Exception::GenericError(playerValidation.value());
+        } else if (!body.empty() && body.size() != HEADER_SEQUENCE_SIZE) {
+            throw Exception::GenericError(std::format("Expected body size 0 or {}, got {}", HEADER_SEQUENCE_SIZE, body.size()));
         }
 
         const std::shared_ptr<Engine::Game>& game = Storage::Cache::Game::GetInstance().GetGameByPlayerId(id);
@@ -32,12 +36,7 @@ void Action::List::SHT::ReceiveMessage(const std::uint32_t id, const std::vector
             throw Exception::GenericError(gameValidation.value());
         }
 
-        const Position& position = player->GetPosition();
-        if (player->IsStatisticActive(Statistic::Force)) {
-            game->CreateMissile(Missile::Force, position);
-        } else {
-            game->CreateMissile(Missile::Player, position);
-        }
+        game->Push({ .type = Engine::Game::Command::Type::Shoot, .player = id, .value = body.empty() ? 0 : Misc::Utils::Deserialize<std::uint32_t>(body) });
     } catch (const Exception::GenericError& ex) {
         Misc::Logger::Log(std::format("Failed to process SHT for player {}: {}", id, ex.what()), Misc::Logger::LogLevel::Critical);
     } catch (const std::exception& ex) {
@@ -12,6 +12,7 @@
 #include "Types.hpp"
 #include "Variables.hpp"
 
+#include <algorithm>
 #include <format>
 
 void Action::List::SPW::SendMessage(const std::uint32_t id, const std::any& content) const
@@ -28,9 +29,20 @@ void Action::List::SPW::SendMessage(const std::uint32_t id, const std::any& cont
         if (entityType > MAX_SPAWNABLE_ENTITY_VALUE) {
             throw Exception::GenericError(std::format("Entity type out of range, got {}", entityType));
         }
-        const std::vector<std::uint8_t> serialized = Misc::Utils::Serialize(entityId, entityType, position);
+        std::vector<std::uint8_t> serialized = {};
 
-        player->PushMessage(Wrapper::Socket::Protocol::UDP, {
+        if (player->GetEncoding() == Encoding::Packed) {
+            std::size_t offset = 0;
+
+            Misc::Utils::WriteId(serialized, offset, entityId);
+            Misc::Utils::WriteBits(serialized, offset, entityType, PACKED_ENTITY_BITS);
+            Misc::Utils::WriteBits(serialized, offset, std::min(position.x, PACKED_COORDINATE_MAX), PACKED_COORDINATE_BITS);
+            Misc::Utils::WriteBits(serialized, offset, std::min(position.y, PACKED_COORDINATE_MAX), PACKED_COORDINATE_BITS);
+        } else {
+            serialized = Misc::Utils::Serialize(entityId, entityType, position);
+        }
+
+        player->PushReliable({
             .type = ActionType::SPW,
             .body = serialized
         });
@@ -29,7 +29,7 @@ void Action::List::STR::ReceiveMessage(const std::uint32_t id, const std::vector
             throw Exception::GenericError(gameValidation.value());
         }
 
-        game->Start();
+        game->Push({ .type = Engine::Game::Command::Type::Start, .player = id, .value = 0 });
     } catch (const Exception::GenericError& ex) {
         Misc::Logger::Log(std::format("Failed to process STR from player {}: {}", id, ex.what()), Misc::Logger::LogLevel::Critical);
     } catch (const std::exception& ex) {
@@ -5,6 +5,7 @@
 ** Game.cpp
 */
 
+#include "Miscellaneous/Environment.hpp"
 #include "Miscellaneous/Logger.hpp"
 #include "Miscellaneous/Utils.hpp"
 #include "Exception/Generic.hpp"
@@ -13,14 +14,18 @@
 #include "Action/List/STP.hpp"
 #include "Storage/Player.hpp"
 #include "Network/Player.hpp"
+#include "Network/Outbox.hpp"
+#include "Storage/Game.hpp"
 #include "Engine/Game.hpp"
 #include "Variables.hpp"
 #include "Types.hpp"
 
 #include <unordered_map>
+#include <algorithm>
 #include <functional>
 #include <optional>
 #include <cstdint>
+#include <cstdlib>
 #include <memory>
 #include <tuple>
 
@@ -38,12 +43,18 @@
     #undef max
 #endif
 
-Engine::Game::Game() : _ids({0}), _wave(nullptr), _id(Misc::Utils::GetNextId("game")), _inactive(false), _started(false)
+Engine::Game::Game() : _sequences({0}), _acknowledged({0}), _inputs({0}), _echoed({0}), _pending({false}), _budget(0), _tick(0), _rewind(0), _tickrate(DEFAULT_TICK_RATE), _ids({0}), _wave(nullptr), _id(Misc::Utils::GetNextId("game")), _inactive(false), _started(false)
 {
+    const Misc::Env::Server& configuration = Misc::Env::GetInstance().GetConfiguration<Misc::Env::Server>();
+
+    _budget = static_cast<std::size_t>(configuration.bandwidth) * 8 / configuration.tickrate;
+    _tickrate = configuration.tickrate;
+    _rewind = std::min<std::uint32_t>(REWIND_HISTORY_SIZE - 1, static_cast<std::uint32_t>(MAX_REWIND_MS) * _tickrate / 1000);
     _clocks = {
         { TimedEvent::Inactivity, Misc::Clock() },
         { TimedEvent::Wave, Misc::Clock() },
-        { TimedEvent::Move, Misc::Clock() }
+        { TimedEvent::Move, Misc::Clock() },
+        { TimedEvent::Report, Misc::Clock() }
     };
     Misc::Logger::Log(std::format("[Game — {}] Created", _id));
 }
@@ -69,7 +80,9 @@ bool Engine::Game::AddPlayerId(const std::uint32_t id)
 
             _ids[slot] = id;
 
+            player->ClearReliable();
             player->SetPosition({0, y});
+            player->SetDirection(Direction::None);
             player->SetPlaying(true);
             player->SetAlive(true);
 
@@ -107,6 +120,9 @@ bool Engine::Game::RemovePlayerId(const std::uint32_t id)
             }
         }
         _ids[slot] = 0;
+        _inputs[slot] = 0;
+        ResetSnapshots(slot);
+        ForgetPosition(id, Misc::Utils::GetEnumIndex(Character::Player));
 
         Misc::Logger::Log(std::format("[Game — {}] Player {} removed", _id, id));
         return true;
@@ -123,6 +139,7 @@ bool Engine::Game::KillPlayerId(const std::uint32_t id)
         if (player) {
             player->SetAlive(false);
         }
+        ForgetPosition(id, Misc::Utils::GetEnumIndex(Character::Player));
 
         Misc::Logger::Log(std::format("[Game — {}] Player {} killed", _id, id));
         for (const std::uint32_t& current : _ids) {
@@ -245,6 +262,7 @@ void Engine::Game::RemoveMissile(const std::uint32_t id, const Missile type)
 
     if (it != missiles.end()) {
         missiles.erase(it);
+        ForgetPosition(id, Misc::Utils::GetEnumIndex(type));
 
         for (const std::uint32_t& current : _ids) {
             if (current != 0) {
@@ -277,18 +295,93 @@ bool Engine::Game::IsInactive()
     return false;
 }
 
+void Engine::Game::Push(const Command& command)
+{
+    _commands.Push(command);
+}
+
+void Engine::Game::ApplyCommands()
+{
+    for (std::optional<Command> command = _commands.Pop(); command.has_value(); command = _commands.Pop()) {
+        try {
+            ApplyCommand(command.value());
+        } catch (const std::exception& ex) {
+            Misc::Logger::Log(std::format("[Game — {}] Failed to apply command {} from player {}: {}", _id, Misc::Utils::GetEnumIndex(command->type), command->player, ex.what()), Misc::Logger::LogLevel::Critical);
+        }
+    }
+}
+
+void Engine::Game::ApplyCommand(const Command& command)
+{
+    if (command.type == Command::Type::Start) {
+        Start();
+        return;
+    } else if (command.type == Command::Type::Join) {
+        if (!_started && Storage::Cache::Game::GetInstance().TryAddPlayerToGame(command.player, _id) && !AddPlayerId(command.player)) {
+            Storage::Cache::Game::GetInstance().RemovePlayerFromGame(command.player);
+        }
+        return;
+    } else if (command.type == Command::Type::Leave) {
+        if (RemovePlayerId(command.player)) {
+            Storage::Cache::Game::GetInstance().RemovePlayerFromGame(command.player);
+        }
+        return;
+    }
+
+    const std::shared_ptr<Network::Player> player = Storage::Cache::Player::GetInstance().GetPlayerById(command.player);
+
+    if (!_started || !player || GetPlayerIdSlot(command.player) == -1) {
+        return;
+    }
+    switch (command.type) {
+        case Command::Type::Move:
+            if (command.sequence != 0) {
+                const std::int8_t slot = GetPlayerIdSlot(command.player);
+                std::uint32_t& input = _inputs[slot];
+
+                if (command.sequence == input) {
+                    _echoed[slot] = 0;
+                    _pending[slot] = true;
+                    break;
+                } else if (command.sequence < input) {
+                    break;
+                }
+                input = command.sequence;
+            }
+            player->SetDirection(static_cast<Direction>(command.value));
+            _pending[GetPlayerIdSlot(command.player)] = true;
+            break;
+        case Command::Type::Shoot:
+            Shoot(player, command.value);
+            break;
+        case Command::Type::God:
+            SetPlayerIdStatistic(player, Statistic::Shield, !player->IsStatisticActive(Statistic::Shield), true);
+            break;
+        case Command::Type::Acknowledge:
+            AcknowledgeSnapshot(command.player, command.value);
+            break;
+        default:
+            break;
+    }
+}
+
 void Engine::Game::Process()
 {
+    ApplyCommands();
+
     if (_started) {
         Wave::Result result = Wave::Result::Continue;
+        const float dt = _clocks.at(TimedEvent::Wave).GetElapsedTimeInSeconds();
 
+        _tick++;
         if (_wave) {
-            const float dt = _clocks.at(TimedEvent::Wave).GetElapsedTimeInSeconds();
             result = _wave->Process(dt);
         }
         switch (result) {
             case Wave::Result::Continue:
+                MovePlayers(dt);
                 MoveEntities();
+                RecordFrame();
                 SendPosition();
                 break;
             case Wave::Result::Next:
@@ -300,6 +393,61 @@ void Engine::Game::Process()
         }
         _clocks.at(TimedEvent::Wave).Reset();
     }
+    ResendMessages();
+    if (_clocks.at(TimedEvent::Report).HasElapsed(LATENCY_REPORT_INTERVAL_MS)) {
+        ReportLatency();
+        _clocks.at(TimedEvent::Report).Reset();
+    }
+    Network::Outbox::GetInstance().Commit(Wrapper::Socket::Protocol::UDP);
+}
+
+void Engine::Game::ResendMessages()
+{
+    for (const std::uint32_t& current : _ids) {
+        if (current != 0) {
+            const std::shared_ptr<Network::Player> player = Storage::Cache::Player::GetInstance().GetPlayerById(current);
+
+            if (player) {
+                player->ResendReliable();
+                player->SendPing();
+            }
+        }
+    }
+}
+
+void Engine::Game::ReportLatency()
+{
+    std::string report = {};
+
+    for (const std::uint32_t& current : _ids) {
+        if (current != 0) {
+            const std::shared_ptr<Network::Player> player = Storage::Cache::Player::GetInstance().GetPlayerById(current);
+
+            const Network::Latency::Estimate latency = player ? player->GetLatency() : Network::Latency::Estimate{};
+
+            if (latency.samples > 0) {
+                report += std::format("{}{}: {:.1f} ms ({:.1f} ms jitter, {:.1f}% loss)", report.empty() ? "" : ", ", current, latency.rtt, latency.jitter, latency.loss * 100.0f);
+            }
+        }
+    }
+    if (!report.empty()) {
+        Misc::Logger::Log(std::format("[Game — {}] Player latency: {}", _id, report));
+    }
+}
+
+void Engine::Game::MovePlayers(const float elapsed)
+{
+    const float step = std::min(elapsed, MAX_MOVE_STEP_MS / 1000.0f);
+
+    for (const std::uint32_t& current : _ids) {
+        if (current != 0) {
+            const std::shared_ptr<Network::Player> player = Storage::Cache::Player::GetInstance().GetPlayerById(current);
+
+            if (player && player->IsAlive() && player->GetDirection() != Direction::None) {
+                QueuePosition(current, Misc::Utils::GetEnumIndex(Character::Player), player->Move(step));
+            }
+        }
+    }
 }
 
 void Engine::Game::MoveEntities()
@@ -368,6 +516,7 @@ void Engine::Game::Start()
         for (const auto& position : positions) {
             Action::Dispatcher::SendMessage(ActionType::STR, position.first, positions);
         }
+        ResetSnapshots();
         _started = true;
     }
 }
@@ -412,26 +561,249 @@ void Engine::Game::Next()
     _enemies.walking.clear();
     _enemies.flying.clear();
 
-    _positions.clear();
+    ResetSnapshots();
 }
 
 void Engine::Game::QueuePosition(const std::uint32_t id, std::uint8_t type, const Position position)
 {
-    if (_positions.size() < std::numeric_limits<std::uint16_t>::max()) {
-        _positions.push_back(std::make_tuple(id, type, position));
-    }
+    _world[GetEntityKey(id, type)] = position;
+    _pending.fill(true);
 }
 
 void Engine::Game::SendPosition()
 {
-    if (!_positions.empty()) {
-        for (const std::uint32_t& current : _ids) {
-            if (current != 0) {
-                Action::Dispatcher::SendMessage(ActionType::POS, current, _positions);
+    for (std::uint8_t slot = 0; slot < MAX_PLAYER_PER_GAMES; slot++) {
+        const bool due = _pending[slot] || _resends[slot].HasElapsed(POSITION_RESEND_MS);
+        const std::shared_ptr<Network::Player> player = _ids[slot] != 0 && due ? Storage::Cache::Player::GetInstance().GetPlayerById(_ids[slot]) : nullptr;
+
+        if (!player) {
+            continue;
+        }
+        if (_acknowledged[slot] != 0 && !GetSnapshot(slot, _acknowledged[slot])) {
+            _known[slot].clear();
+            _acknowledged[slot] = 0;
+        }
+
+        const bool packed = player->GetEncoding() == Encoding::Packed;
+        const auto encode = [packed](const Position& position) {
+            return packed ? Position{ std::min(position.x, PACKED_COORDINATE_MAX), std::min(position.y, PACKED_COORDINATE_MAX) } : position;
+        };
+        const std::unordered_map<std::uint64_t, Position>& known = _known[slot];
+        std::unordered_map<std::uint64_t, float>& priorities = _priorities[slot];
+        std::vector<std::pair<float, std::uint64_t>> candidates = {};
+
+        for (const auto& [key, current] : _world) {
+            const Position position = encode(current);
+            auto it = known.find(key);
+
+            if (it != known.end() && it->second.x == position.x && it->second.y == position.y) {
+                priorities.erase(key);
+                continue;
             }
+            candidates.push_back({ priorities[key] += GetPriority(key, position, _ids[slot], player->GetPosition()), key });
+        }
+        _resends[slot].Reset();
+        if (candidates.empty() && _inputs[slot] == _echoed[slot]) {
+            _pending[slot] = false;
+            continue;
+        }
+        std::sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.first != rhs.first ? lhs.first > rhs.first : lhs.second < rhs.second;
+        });
+
+        const std::uint32_t sequence = ++_sequences[slot];
+        Snapshot snapshot = { .sequence = sequence, .baseline = _acknowledged[slot], .tick = _tick, .changes = {} };
+        std::vector<std::tuple<std::uint32_t, std::uint8_t, Position>> positions = {};
+        std::size_t used = 0;
+
+        for (const auto& [priority, key] : candidates) {
+            const std::uint32_t id = static_cast<std::uint32_t>(key);
+            const std::size_t size = packed ? Misc::Utils::GetIdBits(id) + PACKED_ENTITY_BITS + 2 * PACKED_COORDINATE_BITS : (HEADER_ID_SIZE + 1 + sizeof(Position)) * 8;
+
+            if (!positions.empty() && used + size > _budget) {
+                break;
+            }
+
+            const Position position = encode(_world.at(key));
+            auto it = known.find(key);
+            const Position reference = it != known.end() ? it->second : Position{0, 0};
+
+            positions.push_back(std::make_tuple(id, static_cast<std::uint8_t>(key >> 32), Position{
+                static_cast<std::uint16_t>(position.x ^ reference.x),
+                static_cast<std::uint16_t>(position.y ^ reference.y)
+            }));
+            snapshot.changes.push_back({ key, position });
+            priorities.erase(key);
+            used += size;
+        }
+        Action::Dispatcher::SendMessage(ActionType::POS, _ids[slot], std::make_tuple(sequence, _acknowledged[slot], _inputs[slot], positions));
+        _snapshots[slot][sequence % SNAPSHOT_HISTORY_SIZE] = std::move(snapshot);
+        _echoed[slot] = _inputs[slot];
+        _pending[slot] = positions.size() < candidates.size();
+    }
+}
+
+std::uint64_t Engine::Game::GetEntityKey(const std::uint32_t id, const std::uint8_t entity)
+{
+    return (static_cast<std::uint64_t>(entity) << 32) | id;
+}
+
+const Engine::Game::Snapshot* Engine::Game::GetSnapshot(const std::uint8_t slot, const std::uint32_t sequence) const
+{
+    const Snapshot& snapshot = _snapshots[slot][sequence % SNAPSHOT_HISTORY_SIZE];
+
+    return sequence != 0 && snapshot.sequence == sequence ? &snapshot : nullptr;
+}
+
+void Engine::Game::RecordFrame()
+{
+    Frame& frame = _frames[_tick % REWIND_HISTORY_SIZE];
+
+    frame.tick = _tick;
+    frame.positions.clear();
+    for (const Enemy type : { Enemy::Generic, Enemy::Walking, Enemy::Flying, Enemy::Boss }) {
+        for (const auto& [id, enemy] : GetEnemies(type)) {
+            if (frame.positions.size() == MAX_REWIND_ENTITIES) {
+                return;
+            }
+            frame.positions.push_back({ GetEntityKey(id, Misc::Utils::GetEnumIndex(type)), enemy.position });
+        }
+    }
+}
+
+const Engine::Game::Frame* Engine::Game::GetFrame(const std::uint32_t tick) const
+{
+    const Frame& frame = _frames[tick % REWIND_HISTORY_SIZE];
+
+    return tick != 0 && frame.tick == tick && _tick - tick <= _rewind ? &frame : nullptr;
+}
+
+void Engine::Game::Shoot(const std::shared_ptr<Network::Player>& player, const std::uint32_t snapshot)
+{
+    const Missile type = player->IsStatisticActive(Statistic::Force) ? Missile::Force : Missile::Player;
+    const std::int8_t slot = GetPlayerIdSlot(player->GetId());
+    const Snapshot* view = slot != -1 ? GetSnapshot(static_cast<std::uint8_t>(slot), snapshot) : nullptr;
+    const Frame* frame = view ? GetFrame(view->tick) : nullptr;
+    const Position origin = player->GetPosition();
+
+    if (!frame) {
+        CreateMissile(type, origin);
+        return;
+    }
+
+    const std::uint32_t elapsed = (_tick - frame->tick) * 1000 / _tickrate;
+    const std::uint32_t advance = MISSILE_MOVE_SPEED * elapsed / ENTITY_MOVE_INTERVAL_MS;
+    const std::uint32_t id = CreateMissile(type, { static_cast<std::uint16_t>(std::min<std::uint32_t>(origin.x + advance, WINDOW_WIDTH)), origin.y });
+    Enemies enemies = {};
+    Missiles missiles = {};
+
+    for (const auto& [key, position] : frame->positions) {
+        const Enemy enemy = static_cast<Enemy>(key >> 32);
+        const std::optional<std::reference_wrapper<Entity>> current = GetEnemy(static_cast<std::uint32_t>(key), enemy);
+
+        if (!current.has_value()) {
+            continue;
+        }
+
+        Entity rewound = current->get();
+
+        rewound.position = position;
+        switch (enemy) {
+            case Enemy::Generic:
+                enemies.generic[rewound.id] = rewound;
+                break;
+            case Enemy::Walking:
+                enemies.walking[rewound.id] = rewound;
+                break;
+            case Enemy::Flying:
+                enemies.flying[rewound.id] = rewound;
+                break;
+            case Enemy::Boss:
+                enemies.boss[rewound.id] = rewound;
+                break;
+        }
+    }
+    std::unordered_map<std::uint32_t, Entity>& flight = type == Missile::Force ? missiles.force : missiles.player;
+
+    for (std::uint32_t offset = 0;; offset = std::min(offset + MISSILE_MOVE_SPEED, advance)) {
+        flight[id] = { .position = { static_cast<std::uint16_t>(std::min<std::uint32_t>(origin.x + offset, WINDOW_WIDTH)), origin.y }, .id = id, .health = 0 };
+        for (const Enemies* world : { &enemies, &_enemies }) {
+            const Collision::Result result = Collision::Check({0}, *world, missiles, {});
+
+            if (!result.missiles.player.empty() || !result.missiles.force.empty()) {
+                ApplyCollisions(result);
+                return;
+            }
+        }
+        if (offset == advance) {
+            break;
+        }
+    }
+}
+
+float Engine::Game::GetPriority(const std::uint64_t key, const Position& position, const std::uint32_t viewer, const Position& origin)
+{
+    const std::uint8_t entity = static_cast<std::uint8_t>(key >> 32);
+    const float distance = static_cast<float>(std::abs(position.x - origin.x) + std::abs(position.y - origin.y));
+    const float proximity = 2.0f - std::min(distance, static_cast<float>(WINDOW_WIDTH)) / WINDOW_WIDTH;
+    float weight = PRIORITY_ITEM;
+
+    if (entity == Misc::Utils::GetEnumIndex(Character::Player)) {
+        return static_cast<std::uint32_t>(key) == viewer ? PRIORITY_SELF : PRIORITY_PLAYER;
+    } else if (entity == Misc::Utils::GetEnumIndex(Missile::Enemy) || entity == Misc::Utils::GetEnumIndex(Missile::Boss)) {
+        weight = PRIORITY_THREAT;
+    } else if (entity >= Misc::Utils::GetEnumIndex(Enemy::Generic) && entity <= Misc::Utils::GetEnumIndex(Enemy::Boss)) {
+        weight = PRIORITY_ENEMY;
+    } else if (entity == Misc::Utils::GetEnumIndex(Missile::Player) || entity == Misc::Utils::GetEnumIndex(Missile::Force)) {
+        weight = PRIORITY_MISSILE;
+    }
+    return weight * proximity;
+}
+
+void Engine::Game::ForgetPosition(const std::uint32_t id, const std::uint8_t entity)
+{
+    const std::uint64_t key = GetEntityKey(id, entity);
+
+    _world.erase(key);
+    for (std::uint8_t slot = 0; slot < MAX_PLAYER_PER_GAMES; slot++) {
+        _priorities[slot].erase(key);
+        _known[slot].erase(key);
+    }
+}
+
+void Engine::Game::ResetSnapshots()
+{
+    _world.clear();
+    for (std::uint8_t slot = 0; slot < MAX_PLAYER_PER_GAMES; slot++) {
+        ResetSnapshots(slot);
+    }
+}
+
+void Engine::Game::ResetSnapshots(const std::uint8_t slot)
+{
+    _snapshots[slot] = {};
+    _priorities[slot].clear();
+    _known[slot].clear();
+    _acknowledged[slot] = 0;
+    _echoed[slot] = 0;
+    _pending[slot] = true;
+}
+
+void Engine::Game::AcknowledgeSnapshot(const std::uint32_t id, const std::uint32_t sequence)
+{
+    const std::int8_t slot = GetPlayerIdSlot(id);
+    const Snapshot* snapshot = slot != -1 && sequence > _acknowledged[slot] ? GetSnapshot(static_cast<std::uint8_t>(slot), sequence) : nullptr;
+
+    if (!snapshot || snapshot->baseline != _acknowledged[slot]) {
+        return;
+    }
+    for (const auto& [key, position] : snapshot->changes) {
+        if (_world.contains(key)) {
+            _known[slot][key] = position;
         }
-        _positions.clear();
     }
+    _acknowledged[slot] = sequence;
+    _pending[slot] = true;
 }
 
 std::int8_t Engine::Game::GetPlayerIdSlot(const std::uint32_t id) const
@@ -570,6 +942,7 @@ void Engine::Game::RemoveEnemy(const std::uint32_t id, const Enemy type)
 
     if (it != enemies.end()) {
         enemies.erase(it);
+        ForgetPosition(id, Misc::Utils::GetEnumIndex(type));
 
         for (const std::uint32_t& current : _ids) {
             if (current != 0) {
@@ -697,6 +1070,7 @@ void Engine::Game::RemoveItem(const std::uint32_t id, const Item type)
 
     if (it != items.end()) {
         items.erase(it);
+        ForgetPosition(id, Misc::Utils::GetEnumIndex(type));
 
         for (const std::uint32_t& current : _ids) {
             if (current != 0) {
@@ -0,0 +1,103 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Pool.cpp
+*/
+
+#include "Miscellaneous/Logger.hpp"
+#include "Storage/Game.hpp"
+#include "Engine/Pool.hpp"
+#include "Variables.hpp"
+
+#include <unordered_set>
+#include <format>
+
+Engine::Pool::Pool(const std::uint16_t count) : _utilisation(count, 0.0f)
+{
+    for (std::size_t i = 0; i < count; i++) {
+        _workers.push_back(std::make_unique<Worker>(i, *this));
+    }
+    Misc::Logger::Log(std::format("Pool started with {} workers", count));
+}
+
+Engine::Pool::~Pool()
+{
+    for (const auto& worker : _workers) {
+        worker->Stop();
+    }
+    for (const auto& worker : _workers) {
+        worker->Join();
+    }
+}
+
+void Engine::Pool::Dispatch()
+{
+    const std::vector<std::uint32_t> ids = Storage::Cache::Game::GetInstance().GetGameIds();
+    const std::unordered_set<std::uint32_t> existing(ids.begin(), ids.end());
+
+    for (auto it = _assignments.begin(); it != _assignments.end(); ) {
+        if (existing.contains(it->first)) {
+            ++it;
+        } else {
+            _workers[it->second]->Release(it->first);
+            it = _assignments.erase(it);
+        }
+    }
+
+    for (const std::uint32_t& id : ids) {
+        if (!_assignments.contains(id)) {
+            std::size_t index = 0;
+            std::uint64_t load = _workers[0]->GetLoad();
+
+            for (std::size_t i = 1; i < _workers.size(); i++) {
+                const std::uint64_t current = _workers[i]->GetLoad();
+
+                if (current < load || (current == load && _workers[i]->GetCount() < _workers[index]->GetCount())) {
+                    index = i;
+                    load = current;
+                }
+            }
+            _workers[index]->Assign(id);
+            _assignments.emplace(id, index);
+        }
+    }
+
+    for (const auto& worker : _workers) {
+        worker->Schedule();
+    }
+
+    if (_clock.HasElapsed(WORKER_REPORT_INTERVAL_MS)) {
+        Report();
+        _clock.Reset();
+    }
+}
+
+std::shared_ptr<Engine::Worker::Job> Engine::Pool::Steal(const std::size_t index)
+{
+    for (std::size_t i = 1; i < _workers.size(); i++) {
+        std::shared_ptr<Worker::Job> job = _workers[(index + i) % _workers.size()]->Steal();
+
+        if (job) {
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+const std::vector<float>& Engine::Pool::GetUtilisation() const
+{
+    return _utilisation;
+}
+
+void Engine::Pool::Report()
+{
+    const float elapsed = _clock.GetElapsedTimeInSeconds() * 1000000.0f;
+    std::string report = {};
+
+    for (std::size_t i = 0; i < _workers.size(); i++) {
+        _utilisation[i] = static_cast<float>(_workers[i]->ConsumeBusyTime()) / elapsed;
+        report += std::format("{}{}: {:.1f}% ({} games)", i > 0 ? ", " : "", i, _utilisation[i] * 100.0f, _workers[i]->GetCount());
+    }
+    Misc::Logger::Log(std::format("Worker utilisation: {}", report));
+}
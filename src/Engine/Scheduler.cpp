@@ -0,0 +1,49 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Scheduler.cpp
+*/
+
+#include "Miscellaneous/Logger.hpp"
+#include "Engine/Scheduler.hpp"
+#include "Variables.hpp"
+
+#include <format>
+#include <thread>
+
+Engine::Scheduler::Scheduler(const std::uint16_t rate) : _interval(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::seconds(1)) / rate), _deadline(std::chrono::steady_clock::now()), _tick(0)
+{
+    Misc::Logger::Log(std::format("Scheduler running at {} ticks per second", rate));
+}
+
+void Engine::Scheduler::Run(const std::atomic<bool>& running, const std::function<void()>& tick)
+{
+    _deadline = std::chrono::steady_clock::now() + _interval;
+
+    while (running.load()) {
+        std::this_thread::sleep_until(_deadline);
+
+        std::uint8_t count = 0;
+        while (running.load() && count < MAX_CATCHUP_TICKS && std::chrono::steady_clock::now() >= _deadline) {
+            tick();
+            _deadline += _interval;
+            _tick++;
+            count++;
+        }
+
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+        if (now >= _deadline) {
+            const auto skipped = (now - _deadline) / _interval + 1;
+
+            Misc::Logger::Log(std::format("Scheduler is running behind, skipping {} ticks", skipped), Misc::Logger::LogLevel::Caution);
+            _deadline += _interval * skipped;
+        }
+    }
+}
+
+std::uint64_t Engine::Scheduler::GetTick() const
+{
+    return _tick;
+}
@@ -0,0 +1,201 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Worker.cpp
+*/
+
+#include "Exception/Game/NotExists.hpp"
+#include "Miscellaneous/Logger.hpp"
+#include "Engine/Worker.hpp"
+#include "Storage/Game.hpp"
+#include "Engine/Pool.hpp"
+#include "Variables.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <vector>
+
+Engine::Worker::Worker(const std::size_t index, Pool& pool) : _busy(0), _tick(0), _running(true), _index(index), _pool(pool), _thread(&Engine::Worker::Loop, this) {}
+
+Engine::Worker::~Worker()
+{
+    Stop();
+    Join();
+}
+
+void Engine::Worker::Assign(const std::uint32_t id)
+{
+    std::shared_ptr<Job> job = std::make_shared<Job>();
+
+    job->id = id;
+    job->cost = 0;
+    job->queued = false;
+
+    std::lock_guard<std::mutex> lock(_jobsMutex);
+    _jobs.emplace(id, job);
+}
+
+void Engine::Worker::Release(const std::uint32_t id)
+{
+    std::lock_guard<std::mutex> lock(_jobsMutex);
+    _jobs.erase(id);
+}
+
+void Engine::Worker::Schedule()
+{
+    std::vector<std::shared_ptr<Job>> jobs = {};
+
+    {
+        std::lock_guard<std::mutex> lock(_jobsMutex);
+        jobs.reserve(_jobs.size());
+        for (const auto& [id, job] : _jobs) {
+            if (!job->queued.exchange(true)) {
+                jobs.push_back(job);
+            }
+        }
+    }
+
+    std::sort(jobs.begin(), jobs.end(), [](const std::shared_ptr<Job>& first, const std::shared_ptr<Job>& second) {
+        return first->cost.load() > second->cost.load();
+    });
+
+    {
+        std::lock_guard<std::mutex> lock(_queueMutex);
+        _queue.insert(_queue.end(), jobs.begin(), jobs.end());
+    }
+
+    _tick.fetch_add(1);
+    _tick.notify_one();
+}
+
+std::shared_ptr<Engine::Worker::Job> Engine::Worker::Steal()
+{
+    std::lock_guard<std::mutex> lock(_queueMutex);
+
+    if (_queue.empty()) {
+        return nullptr;
+    }
+    std::shared_ptr<Job> job = _queue.back();
+    _queue.pop_back();
+    return job;
+}
+
+std::shared_ptr<Engine::Worker::Job> Engine::Worker::Pop()
+{
+    std::lock_guard<std::mutex> lock(_queueMutex);
+
+    if (_queue.empty()) {
+        return nullptr;
+    }
+    std::shared_ptr<Job> job = _queue.front();
+    _queue.pop_front();
+    return job;
+}
+
+std::uint64_t Engine::Worker::GetLoad() const
+{
+    std::lock_guard<std::mutex> lock(_jobsMutex);
+    std::uint64_t load = 0;
+
+    for (const auto& [id, job] : _jobs) {
+        load += job->cost.load();
+    }
+    return load;
+}
+
+std::size_t Engine::Worker::GetCount() const
+{
+    std::lock_guard<std::mutex> lock(_jobsMutex);
+    return _jobs.size();
+}
+
+std::uint64_t Engine::Worker::ConsumeBusyTime()
+{
+    return _busy.exchange(0);
+}
+
+void Engine::Worker::Stop()
+{
+    _running = false;
+    _tick.fetch_add(1);
+    _tick.notify_one();
+}
+
+void Engine::Worker::Join()
+{
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+}
+
+void Engine::Worker::Loop()
+{
+    std::uint64_t seen = 0;
+
+    while (_running.load()) {
+        _tick.wait(seen);
+        seen = _tick.load();
+
+        if (!_running.load()) {
+            break;
+        }
+
+        try {
+            Process();
+        } catch (const std::exception& ex) {
+            Misc::Logger::Log(std::format("Worker {} failed to process games: {}", _index, ex.what()), Misc::Logger::LogLevel::Critical);
+        } catch (...) {
+            Misc::Logger::Log(std::format("Worker {} failed to process games: Unknown error", _index), Misc::Logger::LogLevel::Critical);
+        }
+    }
+}
+
+void Engine::Worker::Process()
+{
+    for (std::shared_ptr<Job> job = Pop(); job; job = Pop()) {
+        Run(job);
+    }
+    for (std::shared_ptr<Job> job = _pool.Steal(_index); job; job = _pool.Steal(_index)) {
+        Run(job);
+    }
+}
+
+Engine::Worker::Unqueue::~Unqueue()
+{
+    job.queued = false;
+}
+
+void Engine::Worker::Run(const std::shared_ptr<Job>& job)
+{
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    const Unqueue unqueue = { .job = *job };
+
+    try {
+        std::shared_ptr<Engine::Game> game = Storage::Cache::Game::GetInstance().GetGameById(job->id);
+
+        if (game->IsInactive()) {
+            game.reset();
+            Storage::Cache::Game::GetInstance().RemoveGame(job->id);
+        } else {
+            game->Process();
+        }
+    } catch (const Exception::Game::NotExistsError&) {
+        return;
+    } catch (const std::exception& ex) {
+        Misc::Logger::Log(std::format("Worker {} failed to process game {}: {}", _index, job->id, ex.what()), Misc::Logger::LogLevel::Critical);
+    } catch (...) {
+        Misc::Logger::Log(std::format("Worker {} failed to process game {}: Unknown error", _index, job->id), Misc::Logger::LogLevel::Critical);
+    }
+
+    const std::uint32_t elapsed = static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+    const std::uint32_t cost = job->cost.load();
+
+    if (cost == 0) {
+        job->cost = elapsed;
+    } else {
+        job->cost = cost - cost / GAME_COST_SMOOTHING + elapsed / GAME_COST_SMOOTHING;
+    }
+    _busy.fetch_add(elapsed);
+}
@@ -6,13 +6,14 @@
 */
 
 #include "Miscellaneous/Environment.hpp"
-#include "Exception/Game/NotExists.hpp"
 #include "Miscellaneous/Logger.hpp"
 #include "Miscellaneous/Utils.hpp"
 #include "Network/Transceiver.hpp"
+#include "Network/Outbox.hpp"
 #include "Exception/Generic.hpp"
 #include "Storage/Database.hpp"
-#include "Storage/Game.hpp"
+#include "Engine/Scheduler.hpp"
+#include "Engine/Pool.hpp"
 #include "Variables.hpp"
 
 #include <algorithm>
@@ -21,7 +22,12 @@
 #include <cstdlib>
 #include <thread>
 #include <atomic>
-#include <array>
+#include <vector>
+
+#ifdef __linux__
+    #include <pthread.h>
+    #include <sched.h>
+#endif
 
 /**
  * @brief Atomic boolean to control the running state of the application.
@@ -44,20 +50,47 @@ static void SignalHandler(std::int32_t signal)
     }
 }
 
+/**
+ * @brief Pin a receive thread to the processors whose datagrams are steered to its socket.
+ *
+ * @param thread The receive thread.
+ * @param shard The index of the socket the thread receives from.
+ * @param count The number of datagram sockets.
+ */
+static void PinReceiver([[maybe_unused]] std::thread& thread, [[maybe_unused]] const std::size_t shard, [[maybe_unused]] const std::size_t count)
+{
+#ifdef __linux__
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    for (std::size_t cpu = shard; cpu < std::thread::hardware_concurrency() && cpu < CPU_SETSIZE; cpu += count) {
+        CPU_SET(cpu, &set);
+    }
+    if (pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set) != 0) {
+        Misc::Logger::Log(std::format("Failed to pin receive thread {} to its processors", shard), Misc::Logger::LogLevel::Caution);
+    }
+#endif
+}
+
 /**
  * @brief Create and start transceiver threads.
  *
- * @return An array of threads for the transceiver operations.
+ * @return The threads for the transceiver operations, with one receive thread per datagram socket.
  */
-static std::pair<std::shared_ptr<Network::Transceiver>, std::array<std::thread, 4>> CreateTransciever()
+static std::pair<std::shared_ptr<Network::Transceiver>, std::vector<std::thread>> CreateTransciever()
 {
     std::shared_ptr<Network::Transceiver> transciever = std::make_shared<Network::Transceiver>();
-    std::array<std::thread, 4> threads = {
-        std::thread(&Network::Transceiver::SecureReceive, transciever.get(), std::cref(isRunning)),
-        std::thread(&Network::Transceiver::SecureSend, transciever.get(), std::cref(isRunning)),
-        std::thread(&Network::Transceiver::Receive, transciever.get(), std::cref(isRunning)),
-        std::thread(&Network::Transceiver::Send, transciever.get(), std::cref(isRunning))
-    };
+    std::vector<std::thread> threads = {};
+
+    threads.emplace_back(&Network::Transceiver::SecureReceive, transciever.get(), std::cref(isRunning));
+    threads.emplace_back(&Network::Transceiver::SecureSend, transciever.get(), std::cref(isRunning));
+    threads.emplace_back(&Network::Transceiver::Send, transciever.get(), std::cref(isRunning));
+    for (std::size_t i = 0; i < transciever->GetShardCount(); i++) {
+        threads.emplace_back(&Network::Transceiver::Receive, transciever.get(), std::cref(isRunning), i);
+        if (transciever->IsSteered()) {
+            PinReceiver(threads.back(), i, transciever->GetShardCount());
+        }
+    }
 
     return {transciever, std::move(threads)};
 }
@@ -65,9 +98,9 @@ static std::pair<std::shared_ptr<Network::Transceiver>, std::array<std::thread,
 /**
  * @brief Clean up and join transceiver threads.
  *
- * @param threads The array of threads to clean up.
+ * @param threads The threads to clean up.
  */
-static void CleanTransciever(std::array<std::thread, 4>& threads)
+static void CleanTransciever(std::vector<std::thread>& threads)
 {
     for (auto& thread : threads) {
         if (thread.joinable()) {
@@ -81,39 +114,15 @@ static void CleanTransciever(std::array<std::thread, 4>& threads)
  */
 static void Run()
 {
-    Misc::Clock clock;
-
     try {
-        while (isRunning.load()) {
-            if (clock.HasElapsed(GAME_PROCESS_INTERVAL_MS)) {
-                std::vector<std::uint32_t> ids = Storage::Cache::Game::GetInstance().GetGameIds();
-                std::vector<std::uint32_t> inactives = {};
-
-                for (const std::uint32_t& id : ids) {
-                    try {
-                        std::shared_ptr<Engine::Game> game = Storage::Cache::Game::GetInstance().GetGameById(id);
-                        if (game->IsInactive()) {
-                            inactives.push_back(id);
-                        } else {
-                            game->Process();
-                        }
-                        game.reset();
-                    } catch (const Exception::Game::NotExistsError&) {
-                        continue;
-                    }
-                }
-
-                for (const auto& id : inactives) {
-                    try {
-                        Storage::Cache::Game::GetInstance().RemoveGame(id);
-                    } catch (const Exception::Game::NotExistsError&) {
-                        continue;
-                    }
-                }
-
-                clock.Reset();
-            }
-        }
+        const Misc::Env::Server& configuration = Misc::Env::GetInstance().GetConfiguration<Misc::Env::Server>();
+        Engine::Scheduler scheduler(configuration.tickrate);
+        Engine::Pool pool(configuration.workers);
+
+        scheduler.Run(isRunning, [&pool]() {
+            Network::Outbox::GetInstance().Commit(Wrapper::Socket::Protocol::UDP);
+            pool.Dispatch();
+        });
     } catch (const std::exception& ex) {
         Misc::Logger::Log(std::format("Failed to process main loop: {}", ex.what()), Misc::Logger::LogLevel::Critical);
         isRunning = false;
@@ -144,6 +153,7 @@ std::int32_t main(std::int32_t argc, char **argv)
                 }
             }
 
+            Misc::Utils::CheckPacking();
             Misc::Env::GetInstance().LoadFromFile(file);
             Storage::Database::GetInstance().Connect();
 
@@ -8,10 +8,13 @@
 #include "Miscellaneous/Environment.hpp"
 #include "Miscellaneous/Logger.hpp"
 #include "Exception/Generic.hpp"
+#include "Variables.hpp"
 
 #include <shared_mutex>
 #include <filesystem>
+#include <algorithm>
 #include <format>
+#include <thread>
 
 Misc::Env::Env() : _loaded(false) {}
 
@@ -92,8 +95,41 @@ void Misc::Env::LoadServerFromFile(const libconfig::Setting& setting)
 
     try {
         std::int32_t port = setting.lookup("port");
+        std::int32_t tickrate = DEFAULT_TICK_RATE;
+        std::int32_t workers = static_cast<std::int32_t>(std::clamp(std::thread::hardware_concurrency(), 1u, static_cast<std::uint32_t>(MAX_WORKER_COUNT)));
+        std::int32_t receivers = static_cast<std::int32_t>(std::clamp(std::thread::hardware_concurrency(), 1u, static_cast<std::uint32_t>(MAX_RECEIVER_COUNT)));
+        std::int32_t bandwidth = DEFAULT_POSITION_BANDWIDTH;
+
+        if (setting.exists("tickrate")) {
+            tickrate = setting.lookup("tickrate");
+        }
+        if (setting.exists("workers")) {
+            workers = setting.lookup("workers");
+        }
+        if (setting.exists("receivers")) {
+            receivers = setting.lookup("receivers");
+        }
+        if (setting.exists("bandwidth")) {
+            bandwidth = setting.lookup("bandwidth");
+        }
+        if (tickrate <= 0 || tickrate > MAX_TICK_RATE) {
+            throw Exception::GenericError(std::format("Tick rate must be between 1 and {}, got {}", MAX_TICK_RATE, tickrate));
+        }
+        if (workers <= 0 || workers > MAX_WORKER_COUNT) {
+            throw Exception::GenericError(std::format("Worker count must be between 1 and {}, got {}", MAX_WORKER_COUNT, workers));
+        }
+        if (receivers <= 0 || receivers > MAX_RECEIVER_COUNT) {
+            throw Exception::GenericError(std::format("Receiver count must be between 1 and {}, got {}", MAX_RECEIVER_COUNT, receivers));
+        }
+        if (bandwidth <= 0 || bandwidth > static_cast<std::int32_t>(MAX_POSITION_BANDWIDTH)) {
+            throw Exception::GenericError(std::format("Position bandwidth must be between 1 and {}, got {}", MAX_POSITION_BANDWIDTH, bandwidth));
+        }
 
         _server.port = static_cast<std::uint16_t>(port);
+        _server.tickrate = static_cast<std::uint16_t>(tickrate);
+        _server.workers = static_cast<std::uint16_t>(workers);
+        _server.receivers = static_cast<std::uint16_t>(receivers);
+        _server.bandwidth = static_cast<std::uint32_t>(bandwidth);
     } catch (const libconfig::SettingNotFoundException& ex) {
         throw Exception::GenericError(std::format("Missing configuration parameter: {}", ex.getPath()));
     } catch (const libconfig::SettingTypeException& ex) {
@@ -7,6 +7,7 @@
 
 #include "Miscellaneous/Utils.hpp"
 #include "Exception/Generic.hpp"
+#include "Variables.hpp"
 
 #include <unordered_map>
 #include <algorithm>
@@ -89,6 +90,123 @@ std::uint32_t Misc::Utils::GetNextId(const std::string& key)
     return actual;
 }
 
+void Misc::Utils::WriteBits(std::vector<std::uint8_t>& data, std::size_t& offset, const std::uint32_t value, const std::uint8_t width)
+{
+    const std::uint64_t bits = static_cast<std::uint64_t>(value) & ((std::uint64_t{1} << width) - 1);
+    std::uint8_t written = 0;
+
+    while (written < width) {
+        const std::size_t index = offset / 8;
+        const std::uint8_t shift = offset % 8;
+        const std::uint8_t count = std::min<std::uint8_t>(8 - shift, width - written);
+
+        if (index == data.size()) {
+            data.push_back(0);
+        }
+        data[index] |= static_cast<std::uint8_t>(((bits >> written) & ((1U << count) - 1)) << shift);
+        written += count;
+        offset += count;
+    }
+}
+
+std::uint32_t Misc::Utils::ReadBits(const std::vector<std::uint8_t>& data, std::size_t& offset, const std::uint8_t width)
+{
+    std::uint64_t value = 0;
+    std::uint8_t read = 0;
+
+    if (offset + width > data.size() * 8) {
+        throw Exception::GenericError("Not enough data to read the requested bits");
+    }
+    while (read < width) {
+        const std::uint8_t shift = offset % 8;
+        const std::uint8_t count = std::min<std::uint8_t>(8 - shift, width - read);
+
+        value |= static_cast<std::uint64_t>((data[offset / 8] >> shift) & ((1U << count) - 1)) << read;
+        read += count;
+        offset += count;
+    }
+    return static_cast<std::uint32_t>(value);
+}
+
+void Misc::Utils::WriteId(std::vector<std::uint8_t>& data, std::size_t& offset, const std::uint32_t id)
+{
+    const std::size_t index = GetIdClass(id);
+
+    WriteBits(data, offset, static_cast<std::uint32_t>(index), PACKED_ID_CLASS_BITS);
+    WriteBits(data, offset, id, PACKED_ID_WIDTHS[index]);
+}
+
+std::uint32_t Misc::Utils::ReadId(const std::vector<std::uint8_t>& data, std::size_t& offset)
+{
+    const std::uint32_t index = ReadBits(data, offset, PACKED_ID_CLASS_BITS);
+
+    return ReadBits(data, offset, PACKED_ID_WIDTHS[index]);
+}
+
+std::uint8_t Misc::Utils::GetIdBits(const std::uint32_t id)
+{
+    return PACKED_ID_CLASS_BITS + PACKED_ID_WIDTHS[GetIdClass(id)];
+}
+
+std::size_t Misc::Utils::GetIdClass(const std::uint32_t id)
+{
+    std::size_t index = 0;
+
+    while (index + 1 < PACKED_ID_WIDTHS.size() && (static_cast<std::uint64_t>(id) >> PACKED_ID_WIDTHS[index]) != 0) {
+        index++;
+    }
+    return index;
+}
+
+void Misc::Utils::CheckPacking()
+{
+    const std::vector<std::uint32_t> ids = {0, 63, 64, 4095, 4096, (1U << 20) - 1, 1U << 20, std::numeric_limits<std::uint32_t>::max()};
+    const std::vector<std::uint16_t> coordinates = {0, 1, PACKED_COORDINATE_MAX - 1, PACKED_COORDINATE_MAX};
+    const std::uint8_t type = (1 << PACKED_ENTITY_BITS) - 1;
+    std::vector<std::uint8_t> data = {};
+    std::size_t offset = 0;
+
+    for (const std::uint32_t id : ids) {
+        for (const std::uint16_t coordinate : coordinates) {
+            WriteId(data, offset, id);
+            WriteBits(data, offset, type, PACKED_ENTITY_BITS);
+            WriteBits(data, offset, coordinate, PACKED_COORDINATE_BITS);
+            WriteBits(data, offset, PACKED_COORDINATE_MAX - coordinate, PACKED_COORDINATE_BITS);
+        }
+        WriteId(data, offset, id);
+        WriteBits(data, offset, type, PACKED_ENTITY_BITS);
+    }
+    if (data.size() != (offset + 7) / 8) {
+        throw Exception::GenericError(std::format("Packed message holds {} bytes for {} bits", data.size(), offset));
+    }
+
+    const std::size_t total = offset;
+
+    offset = 0;
+    for (const std::uint32_t id : ids) {
+        for (const std::uint16_t coordinate : coordinates) {
+            const std::uint32_t readId = ReadId(data, offset);
+            const std::uint32_t readType = ReadBits(data, offset, PACKED_ENTITY_BITS);
+            const std::uint32_t x = ReadBits(data, offset, PACKED_COORDINATE_BITS);
+            const std::uint32_t y = ReadBits(data, offset, PACKED_COORDINATE_BITS);
+
+            if (readId != id || readType != type || x != coordinate || y != static_cast<std::uint32_t>(PACKED_COORDINATE_MAX - coordinate)) {
+                throw Exception::GenericError(std::format("Packed position of entity {} at {} read back as entity {} of type {} at {}, {}", id, coordinate, readId, readType, x, y));
+            }
+        }
+
+        const std::uint32_t readId = ReadId(data, offset);
+        const std::uint32_t readType = ReadBits(data, offset, PACKED_ENTITY_BITS);
+
+        if (readId != id || readType != type) {
+            throw Exception::GenericError(std::format("Packed death of entity {} read back as entity {} of type {}", id, readId, readType));
+        }
+    }
+    if (offset != total) {
+        throw Exception::GenericError(std::format("Packed message of {} bits read back as {} bits", total, offset));
+    }
+}
+
 void Misc::Utils::AppendToVector(std::vector<std::uint8_t>& target, const std::vector<std::uint8_t>& source)
 {
     target.insert(target.end(), source.begin(), source.end());
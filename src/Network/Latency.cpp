@@ -0,0 +1,75 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Latency.cpp
+*/
+
+#include "Miscellaneous/Utils.hpp"
+#include "Network/Latency.hpp"
+#include "Variables.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+Network::Latency::Latency() : _sequence(0), _last(0.0f), _estimate({ .rtt = 0.0f, .jitter = 0.0f, .loss = 0.0f, .samples = 0 })
+{
+}
+
+bool Network::Latency::Probe(std::vector<std::uint8_t>& body)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    const std::uint64_t now = GetTimestamp();
+
+    body.clear();
+    while (!_outstanding.empty() && now - _outstanding.front().timestamp > static_cast<std::uint64_t>(PING_TIMEOUT_MS) * 1000) {
+        _estimate.loss += (1.0f - _estimate.loss) / LATENCY_SMOOTHING;
+        _outstanding.pop_front();
+    }
+    if (!_clock.HasElapsed(PING_INTERVAL_MS)) {
+        return false;
+    }
+    _outstanding.push_back({ .sequence = ++_sequence, .timestamp = now });
+    body = Misc::Utils::Serialize(_sequence, now, static_cast<std::uint32_t>(_estimate.rtt * 1000.0f));
+    _clock.Reset();
+    return true;
+}
+
+bool Network::Latency::Record(const std::uint32_t sequence, const std::uint64_t timestamp)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = std::find_if(_outstanding.begin(), _outstanding.end(), [sequence](const Outstanding& probe) {
+        return probe.sequence == sequence;
+    });
+
+    if (it == _outstanding.end() || it->timestamp != timestamp) {
+        return false;
+    }
+
+    const float sample = static_cast<float>(GetTimestamp() - it->timestamp) / 1000.0f;
+
+    _outstanding.erase(it);
+    _estimate.loss -= _estimate.loss / LATENCY_SMOOTHING;
+    if (_estimate.samples == 0) {
+        _estimate.rtt = sample;
+    } else {
+        _estimate.rtt += (sample - _estimate.rtt) / LATENCY_SMOOTHING;
+        _estimate.jitter += (std::abs(sample - _last) - _estimate.jitter) / JITTER_SMOOTHING;
+    }
+    _last = sample;
+    _estimate.samples++;
+    return true;
+}
+
+Network::Latency::Estimate Network::Latency::GetEstimate() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    return _estimate;
+}
+
+std::uint64_t Network::Latency::GetTimestamp()
+{
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
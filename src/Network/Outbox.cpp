@@ -0,0 +1,69 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Outbox.cpp
+*/
+
+#include "Network/Outbox.hpp"
+
+#include <chrono>
+
+Network::Outbox::Outbox()
+{
+    _udp.deferred = true;
+}
+
+void Network::Outbox::Notify(const Wrapper::Socket::Protocol& protocol, const std::uint32_t id)
+{
+    Channel& channel = GetChannel(protocol);
+    bool wake = false;
+
+    {
+        std::lock_guard<std::mutex> lock(channel.mutex);
+        wake = channel.ready.empty() && !channel.deferred;
+        channel.ready.push_back(id);
+    }
+    if (wake) {
+        channel.condition.notify_one();
+    }
+}
+
+bool Network::Outbox::Wait(const Wrapper::Socket::Protocol& protocol, std::vector<std::uint32_t>& ready, const std::uint32_t timeout)
+{
+    Channel& channel = GetChannel(protocol);
+    std::unique_lock<std::mutex> lock(channel.mutex);
+
+    ready.clear();
+    if (!channel.condition.wait_for(lock, std::chrono::milliseconds(timeout), [&channel]() {
+        return !channel.ready.empty() && (!channel.deferred || channel.committed);
+    })) {
+        return false;
+    }
+    ready.swap(channel.ready);
+    channel.committed = false;
+    return true;
+}
+
+void Network::Outbox::Commit(const Wrapper::Socket::Protocol& protocol)
+{
+    Channel& channel = GetChannel(protocol);
+    bool wake = false;
+
+    {
+        std::lock_guard<std::mutex> lock(channel.mutex);
+        wake = !channel.ready.empty() && !channel.committed;
+        channel.committed = channel.committed || wake;
+    }
+    if (wake) {
+        channel.condition.notify_one();
+    }
+}
+
+Network::Outbox::Channel& Network::Outbox::GetChannel(const Wrapper::Socket::Protocol& protocol)
+{
+    if (protocol != Wrapper::Socket::Protocol::TCP) {
+        return _udp;
+    }
+    return _tcp;
+}
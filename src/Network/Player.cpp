@@ -11,14 +11,17 @@
 #include "Miscellaneous/Utils.hpp"
 #include "Storage/Database.hpp"
 #include "Network/Player.hpp"
+#include "Network/Outbox.hpp"
 #include "Variables.hpp"
 #include "Types.hpp"
 
+#include <algorithm>
 #include <cctype>
 #include <format>
 
-Network::Player::Player(const std::string& address, const std::uint16_t port) : _address(address), _port(port), _id(Misc::Utils::GetNextId("player")), _position({0, 0}), _role(Role::Player), _playing(false), _alive(true), _god(false)
+Network::Player::Player(const std::string& address, const std::uint16_t port) : _address(address), _port(port), _endpoint({}), _id(Misc::Utils::GetNextId("player")), _position({0, 0}), _direction(Direction::None), _remainder({0.0f, 0.0f}), _role(Role::Player), _playing(false), _alive(true), _god(false), _evicted(false), _dropped(0), _encoding(Encoding::Plain)
 {
+    Wrapper::Socket::ToEndpoint(address, port, _endpoint);
     _statistics = {
         { Statistic::Shield, { Misc::Clock(), false } },
         { Statistic::Force, { Misc::Clock(), false } }
@@ -28,17 +31,45 @@ Network::Player::Player(const std::string& address, const std::uint16_t port) :
 
 Network::Player::~Player()
 {
-    Misc::Logger::Log(std::format("Player {} disconnected", _id));
+    const Latency::Estimate latency = _latency.GetEstimate();
+    std::string details = {};
+
+    if (_dropped.load() > 0) {
+        details += std::format(", {} datagrams dropped", _dropped.load());
+    }
+    if (latency.samples > 0) {
+        details += std::format(", {:.1f} ms round trip, {:.1f} ms jitter, {:.1f}% loss", latency.rtt, latency.jitter, latency.loss * 100.0f);
+    }
+    Misc::Logger::Log(std::format("Player {} disconnected{}", _id, details));
 }
 
 void Network::Player::PushMessage(const Wrapper::Socket::Protocol& protocol, const Message& message)
 {
+    bool notify = false;
+
     if (protocol != Wrapper::Socket::Protocol::TCP) {
         std::lock_guard<std::mutex> lock(_udpMutex);
+        notify = _udp.empty();
+        if (_udp.size() >= MAX_UDP_QUEUE_SIZE) {
+            _udp.pop();
+            _dropped.fetch_add(1);
+        }
         _udp.push(message);
     } else {
         std::lock_guard<std::mutex> lock(_tcpMutex);
-        _tcp.push(message);
+        if (_evicted.load()) {
+            return;
+        } else if (_tcp.size() >= MAX_TCP_QUEUE_SIZE) {
+            Misc::Logger::Log(std::format("Player {} has {} messages waiting, evicting", _id, _tcp.size()), Misc::Logger::LogLevel::Caution);
+            _evicted.store(true);
+            notify = true;
+        } else {
+            notify = _tcp.empty();
+            _tcp.push(message);
+        }
+    }
+    if (notify) {
+        Network::Outbox::GetInstance().Notify(protocol, _id);
     }
 }
 
@@ -63,6 +94,83 @@ const Network::Player::Message Network::Player::PopMessage(const Wrapper::Socket
     }
 }
 
+void Network::Player::PushReliable(const Message& message)
+{
+    if (_evicted.load()) {
+        return;
+    } else if (_reliable.IsFull()) {
+        Misc::Logger::Log(std::format("Player {} has {} reliable messages waiting, evicting", _id, MAX_RELIABLE_PENDING), Misc::Logger::LogLevel::Caution);
+        _evicted.store(true);
+        Network::Outbox::GetInstance().Notify(Wrapper::Socket::Protocol::TCP, _id);
+        return;
+    }
+    PushMessage(Wrapper::Socket::Protocol::UDP, { .type = ActionType::REL, .body = _reliable.Push(message.type, message.body) });
+}
+
+void Network::Player::AcknowledgeReliable(const std::uint32_t latest, const std::uint32_t mask)
+{
+    _reliable.Acknowledge(latest, mask);
+}
+
+void Network::Player::ClearReliable()
+{
+    _reliable.Clear();
+}
+
+void Network::Player::ResendReliable()
+{
+    std::vector<std::vector<std::uint8_t>> due = {};
+
+    _reliable.Collect(due);
+    for (std::vector<std::uint8_t>& body : due) {
+        PushMessage(Wrapper::Socket::Protocol::UDP, { .type = ActionType::REL, .body = std::move(body) });
+    }
+}
+
+void Network::Player::SendPing()
+{
+    std::vector<std::uint8_t> body = {};
+
+    if (_latency.Probe(body)) {
+        PushMessage(Wrapper::Socket::Protocol::UDP, { .type = ActionType::PNG, .body = std::move(body) });
+    }
+}
+
+bool Network::Player::RecordPing(const std::uint32_t sequence, const std::uint64_t timestamp)
+{
+    return _latency.Record(sequence, timestamp);
+}
+
+Network::Latency::Estimate Network::Player::GetLatency() const
+{
+    return _latency.GetEstimate();
+}
+
+void Network::Player::Evict()
+{
+    _evicted.store(true);
+}
+
+bool Network::Player::IsEvicted() const
+{
+    return _evicted.load();
+}
+
+std::uint64_t Network::Player::GetDroppedCount() const
+{
+    return _dropped.load();
+}
+
+void Network::Player::SetEncoding(const Encoding encoding)
+{
+    _encoding.store(encoding);
+}
+
+Encoding Network::Player::GetEncoding() const
+{
+    return _encoding.load();
+}
+
 bool Network::Player::HasMessage(const Wrapper::Socket::Protocol& protocol) const
 {
     if (protocol != Wrapper::Socket::Protocol::TCP) {
@@ -155,48 +263,61 @@ bool Network::Player::Register(const std::string& username, const std::string& p
     }
 }
 
-const Position& Network::Player::Move(const Direction& direction)
+void Network::Player::SetDirection(const Direction& direction)
+{
+    if (direction != _direction) {
+        _direction = direction;
+        _remainder = {0.0f, 0.0f};
+    }
+}
+
+const Direction& Network::Player::GetDirection() const
+{
+    return _direction;
+}
+
+const Position& Network::Player::Move(const float elapsed)
 {
-    Misc::Maths::Vector2<std::int8_t> offset = {0, 0};
+    Misc::Maths::Vector2<std::int8_t> sign = {0, 0};
 
-    switch (direction) {
+    switch (_direction) {
         case Direction::Up:
-            offset.y = -PLAYER_MOVE_SPEED;
+            sign.y = -1;
             break;
         case Direction::Down:
-            offset.y = PLAYER_MOVE_SPEED;
+            sign.y = 1;
             break;
         case Direction::Left:
-            offset.x = -PLAYER_MOVE_SPEED;
+            sign.x = -1;
             break;
         case Direction::Right:
-            offset.x = PLAYER_MOVE_SPEED;
+            sign.x = 1;
             break;
         case Direction::UpRight:
-            offset.x = PLAYER_MOVE_SPEED;
-            offset.y = -PLAYER_MOVE_SPEED;
+            sign = {1, -1};
             break;
         case Direction::UpLeft:
-            offset.x = -PLAYER_MOVE_SPEED;
-            offset.y = -PLAYER_MOVE_SPEED;
+            sign = {-1, -1};
             break;
         case Direction::DownRight:
-            offset.x = PLAYER_MOVE_SPEED;
-            offset.y = PLAYER_MOVE_SPEED;
+            sign = {1, 1};
             break;
         case Direction::DownLeft:
-            offset.x = -PLAYER_MOVE_SPEED;
-            offset.y = PLAYER_MOVE_SPEED;
+            sign = {-1, 1};
             break;
         default:
-            break;
-    }
-    if (_position.x + offset.x >= 0 && _position.x + offset.x <= WINDOW_WIDTH) {
-        _position.x += offset.x;
-    }
-    if (_position.y + offset.y >= 0 && _position.y + offset.y <= WINDOW_HEIGHT) {
-        _position.y += offset.y;
+            return _position;
     }
+    _remainder.x += static_cast<float>(sign.x * PLAYER_MOVE_SPEED) * elapsed;
+    _remainder.y += static_cast<float>(sign.y * PLAYER_MOVE_SPEED) * elapsed;
+
+    const std::int32_t dx = static_cast<std::int32_t>(_remainder.x);
+    const std::int32_t dy = static_cast<std::int32_t>(_remainder.y);
+
+    _remainder.x -= static_cast<float>(dx);
+    _remainder.y -= static_cast<float>(dy);
+    _position.x = static_cast<std::uint16_t>(std::clamp<std::int32_t>(_position.x + dx, 0, WINDOW_WIDTH));
+    _position.y = static_cast<std::uint16_t>(std::clamp<std::int32_t>(_position.y + dy, 0, WINDOW_HEIGHT));
     return _position;
 }
 
@@ -215,6 +336,11 @@ std::uint16_t Network::Player::GetPort() const
     return _port;
 }
 
+const struct sockaddr_in& Network::Player::GetEndpoint() const
+{
+    return _endpoint;
+}
+
 std::uint32_t Network::Player::GetId() const
 {
     return _id;
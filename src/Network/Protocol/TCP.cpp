@@ -10,7 +10,9 @@
 #include "Miscellaneous/Utils.hpp"
 #include "Action/Dispatcher.hpp"
 #include "Storage/Player.hpp"
+#include "Variables.hpp"
 
+#include <cstring>
 #include <format>
 
 std::vector<std::uint8_t> Network::Protocol::TCP::SerializeHeader(const Header& header)
@@ -27,33 +29,80 @@ std::vector<std::uint8_t> Network::Protocol::TCP::SerializeHeader(const Header&
 
 bool Network::Protocol::TCP::ReceiveMessage(const Wrapper::Socket::SocketType socket)
 {
-    std::vector<std::uint8_t> content = Wrapper::Socket::Receive(socket, TCP_HEADER_SIZE);
+    Stream& stream = _streams[socket];
 
-    if (content.empty()) {
-        return true;
-    } else if (content.size() < TCP_HEADER_SIZE) {
-        Misc::Logger::Log(std::format("Failed to read header from player {}: incomplete header", socket), Misc::Logger::LogLevel::Caution);
-        return false;
+    while (true) {
+        Reserve(stream);
+
+        const Wrapper::Socket::TransmitType bytes = Wrapper::Socket::Receive(socket, stream.data.data() + stream.end, stream.data.size() - stream.end);
+
+        if (bytes == 0) {
+            return true;
+        } else if (bytes < 0 && Wrapper::Socket::WouldBlock()) {
+            return false;
+        } else if (bytes < 0) {
+            Misc::Logger::Log(std::format("Failed to read from socket {}: {}", socket, Wrapper::Socket::GetLastError()), Misc::Logger::LogLevel::Caution);
+            return true;
+        }
+
+        stream.end += static_cast<std::size_t>(bytes);
+        if (Extract(socket, stream)) {
+            return true;
+        }
     }
+}
 
-    Header header = ParseHeader(content);
-    std::vector<std::uint8_t> body = Wrapper::Socket::Receive(socket, header.length);
+void Network::Protocol::TCP::Release(const Wrapper::Socket::SocketType socket)
+{
+    _streams.erase(socket);
+}
 
-    if (body.size() != header.length) {
-        Misc::Logger::Log(std::format("Failed to read body from player {}: expected {} bytes, got {}", socket, header.length, body.size()), Misc::Logger::LogLevel::Caution);
-        return false;
+void Network::Protocol::TCP::Reserve(Stream& stream)
+{
+    if (stream.begin == stream.end) {
+        stream.begin = 0;
+        stream.end = 0;
+        if (stream.data.size() > TCP_RECEIVE_CHUNK_SIZE) {
+            stream.data.resize(TCP_RECEIVE_CHUNK_SIZE);
+            stream.data.shrink_to_fit();
+        }
+    } else if (stream.begin > 0) {
+        std::memmove(stream.data.data(), stream.data.data() + stream.begin, stream.end - stream.begin);
+        stream.end -= stream.begin;
+        stream.begin = 0;
     }
 
-    std::optional<std::uint32_t> id = Storage::Cache::Player::GetInstance().GetPlayerIdBySocket(socket);
+    if (stream.data.size() - stream.end < TCP_RECEIVE_CHUNK_SIZE) {
+        stream.data.resize(stream.end + TCP_RECEIVE_CHUNK_SIZE);
+    }
+}
 
-    if (id.has_value()) {
-        Misc::Logger::Log(std::format("Received message from player {}: {} {}", id.value(), Misc::Utils::BytesToHex(content), Misc::Utils::BytesToHex(body)), Misc::Logger::LogLevel::Network);
+bool Network::Protocol::TCP::Extract(const Wrapper::Socket::SocketType socket, Stream& stream)
+{
+    while (stream.end - stream.begin >= TCP_HEADER_SIZE) {
+        const std::uint8_t* content = stream.data.data() + stream.begin;
+        const Header header = ParseHeader(content);
+
+        if (header.length > MAX_TCP_FRAME_SIZE) {
+            Misc::Logger::Log(std::format("Received oversized message from socket {}: {} bytes announced, limit is {}", socket, header.length, MAX_TCP_FRAME_SIZE), Misc::Logger::LogLevel::Caution);
+            return true;
+        } else if (stream.end - stream.begin < TCP_HEADER_SIZE + header.length) {
+            return false;
+        }
+
+        const std::vector<std::uint8_t> body(content + TCP_HEADER_SIZE, content + TCP_HEADER_SIZE + header.length);
+        const std::optional<std::uint32_t> id = Storage::Cache::Player::GetInstance().GetPlayerIdBySocket(socket);
+
+        stream.begin += TCP_HEADER_SIZE + header.length;
+        if (!id.has_value()) {
+            Misc::Logger::Log(std::format("Received message from unknown socket {}, skipping", socket), Misc::Logger::LogLevel::Caution);
+            return true;
+        }
+
+        Misc::Logger::Log(std::format("Received message from player {}: {} {}", id.value(), Misc::Utils::BytesToHex(std::vector<std::uint8_t>(content, content + TCP_HEADER_SIZE)), Misc::Utils::BytesToHex(body)), Misc::Logger::LogLevel::Network);
         Action::Dispatcher::ReceiveMessage(header.type, id.value(), body);
-        return false;
-    } else {
-        Misc::Logger::Log(std::format("Received message from unknown socket {}, skipping", socket), Misc::Logger::LogLevel::Caution);
-        return true;
     }
+    return false;
 }
 
 void Network::Protocol::TCP::SendMessage(const Wrapper::Socket::SocketType socket)
@@ -64,40 +113,126 @@ void Network::Protocol::TCP::SendMessage(const Wrapper::Socket::SocketType socke
         const std::shared_ptr<Network::Player>& player = Storage::Cache::Player::GetInstance().GetPlayerById(id.value());
 
         if (player) {
-            while (player->HasMessage(Wrapper::Socket::Protocol::TCP)) {
-                const Network::Player::Message message = player->PopMessage(Wrapper::Socket::Protocol::TCP);
-
-                const std::uint32_t size = static_cast<std::uint32_t>(message.body.size());
-                const std::vector<std::uint8_t> header = SerializeHeader({
-                    .type = message.type,
-                    .length = size
-                });
-                std::vector<std::uint8_t> serialized = {};
-
-                serialized.reserve(header.size() + size);
-                serialized.insert(serialized.end(), header.begin(), header.end());
-                serialized.insert(serialized.end(), message.body.begin(), message.body.end());
-
-                if (Wrapper::Socket::Send(socket, serialized) < 0) {
-                    Misc::Logger::Log(std::format("Failed to send message to player {}: {}", id.value(), Wrapper::Socket::GetLastError()), Misc::Logger::LogLevel::Critical);
-                } else {
-                    Misc::Logger::Log(std::format("Sent message to player {}: {} {}", id.value(), Misc::Utils::BytesToHex(header), Misc::Utils::BytesToHex(message.body)), Misc::Logger::LogLevel::Network);
-                }
+            Output& output = _outputs[id.value()];
+
+            while (!player->IsEvicted() && player->HasMessage(Wrapper::Socket::Protocol::TCP)) {
+                Network::Player::Message message = player->PopMessage(Wrapper::Socket::Protocol::TCP);
+                Frame frame = {
+                    .header = SerializeHeader({
+                        .type = message.type,
+                        .length = static_cast<std::uint32_t>(message.body.size())
+                    }),
+                    .body = std::move(message.body)
+                };
+
+                Misc::Logger::Log(std::format("Queued message to player {}: {} {}", id.value(), Misc::Utils::BytesToHex(frame.header), Misc::Utils::BytesToHex(frame.body)), Misc::Logger::LogLevel::Network);
+                output.bytes += frame.header.size() + frame.body.size();
+                output.frames.push_back(std::move(frame));
+            }
+
+            if (!player->IsEvicted() && !Write(socket, output)) {
+                Misc::Logger::Log(std::format("Failed to send messages to player {}: {}", id.value(), Wrapper::Socket::GetLastError()), Misc::Logger::LogLevel::Critical);
+                output.frames.clear();
+            }
+            if (player->IsEvicted() || output.bytes > MAX_TCP_PENDING_BYTES) {
+                Evict(socket, id.value(), output);
+                _outputs.erase(id.value());
+            } else if (output.frames.empty()) {
+                _outputs.erase(id.value());
             }
         }
     }
 }
 
-Network::Protocol::TCP::Header Network::Protocol::TCP::ParseHeader(const std::vector<std::uint8_t>& content)
+void Network::Protocol::TCP::Flush()
 {
-    Header header = { .type = ActionType::UKN, .length = 0 };
+    for (auto it = _outputs.begin(); it != _outputs.end();) {
+        const std::optional<Wrapper::Socket::SocketType> socket = Storage::Cache::Player::GetInstance().GetSocketByPlayerId(it->first);
 
-    if (content.size() < TCP_HEADER_SIZE) {
-        return header;
+        if (!socket.has_value()) {
+            it = _outputs.erase(it);
+            continue;
+        }
+        if (!Write(socket.value(), it->second)) {
+            Misc::Logger::Log(std::format("Failed to send messages to player {}: {}", it->first, Wrapper::Socket::GetLastError()), Misc::Logger::LogLevel::Critical);
+            it->second.frames.clear();
+        }
+        if (it->second.bytes > MAX_TCP_PENDING_BYTES) {
+            Evict(socket.value(), it->first, it->second);
+            it = _outputs.erase(it);
+        } else if (it->second.frames.empty()) {
+            it = _outputs.erase(it);
+        } else {
+            ++it;
+        }
     }
+}
+
+void Network::Protocol::TCP::Evict(const Wrapper::Socket::SocketType socket, const std::uint32_t id, const Output& output)
+{
+    const std::shared_ptr<Network::Player>& player = Storage::Cache::Player::GetInstance().GetPlayerById(id);
+
+    if (player) {
+        player->Evict();
+    }
+    Misc::Logger::Log(std::format("Evicting player {} with {} unsent bytes", id, output.bytes), Misc::Logger::LogLevel::Caution);
+    if (!Wrapper::Socket::Shutdown(socket)) {
+        Misc::Logger::Log(std::format("Failed to shut down socket {}: {}", socket, Wrapper::Socket::GetLastError()), Misc::Logger::LogLevel::Critical);
+    }
+}
+
+bool Network::Protocol::TCP::HasPending() const
+{
+    return !_outputs.empty();
+}
+
+bool Network::Protocol::TCP::Write(const Wrapper::Socket::SocketType socket, Output& output)
+{
+    while (!output.frames.empty()) {
+        std::size_t offset = output.offset;
+
+        _buffers.clear();
+        for (const Frame& frame : output.frames) {
+            if (offset < frame.header.size()) {
+                _buffers.push_back(Wrapper::Socket::MakeBuffer(frame.header.data() + offset, frame.header.size() - offset));
+                offset = 0;
+            } else {
+                offset -= frame.header.size();
+            }
+            if (offset < frame.body.size()) {
+                _buffers.push_back(Wrapper::Socket::MakeBuffer(frame.body.data() + offset, frame.body.size() - offset));
+            }
+            offset = 0;
+            if (_buffers.size() + 2 > TCP_MAX_BUFFERS) {
+                break;
+            }
+        }
+
+        const Wrapper::Socket::TransmitType bytes = Wrapper::Socket::Send(socket, _buffers);
+
+        if (bytes < 0) {
+            return Wrapper::Socket::WouldBlock();
+        }
+
+        std::size_t sent = output.offset + static_cast<std::size_t>(bytes);
+
+        while (!output.frames.empty() && sent >= output.frames.front().header.size() + output.frames.front().body.size()) {
+            sent -= output.frames.front().header.size() + output.frames.front().body.size();
+            output.bytes -= output.frames.front().header.size() + output.frames.front().body.size();
+            output.frames.pop_front();
+        }
+        output.offset = sent;
+    }
+    output.offset = 0;
+    return true;
+}
+
+Network::Protocol::TCP::Header Network::Protocol::TCP::ParseHeader(const std::uint8_t* content)
+{
+    Header header = { .type = ActionType::UKN, .length = 0 };
 
-    std::memcpy(&header.type, content.data(), HEADER_TYPE_SIZE);
-    std::memcpy(&header.length, content.data() + HEADER_TYPE_SIZE, HEADER_LENGTH_SIZE);
+    std::memcpy(&header.type, content, HEADER_TYPE_SIZE);
+    std::memcpy(&header.length, content + HEADER_TYPE_SIZE, HEADER_LENGTH_SIZE);
 
     return header;
 }
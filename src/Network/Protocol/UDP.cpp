@@ -8,31 +8,78 @@
 #include "Miscellaneous/Logger.hpp"
 #include "Network/Protocol/UDP.hpp"
 #include "Miscellaneous/Utils.hpp"
+#include "Exception/Generic.hpp"
 #include "Action/Dispatcher.hpp"
 #include "Network/Player.hpp"
 #include "Storage/Player.hpp"
+#include "Variables.hpp"
 
+#include <algorithm>
+#include <limits>
 #include <format>
 
-Network::Protocol::UDP::UDP(const Wrapper::Socket::SocketType socket) : _socket(socket) {}
+Network::Protocol::UDP::UDP(const Wrapper::Socket::SocketType socket) : _socket(socket), _batch(UDP_BATCH_SIZE), _outgoing(UDP_BATCH_SIZE), _bundled(0), _sequence(0)
+{
+#ifdef USE_IO_URING
+    try {
+        _receiver = std::make_unique<Wrapper::Ring>(socket);
+        _sender = std::make_unique<Wrapper::Ring>(socket);
+        Misc::Logger::Log("Using io_uring for datagrams");
+    } catch (const std::exception& ex) {
+        _receiver.reset();
+        _sender.reset();
+        Misc::Logger::Log(std::format("Falling back to system calls for datagrams: {}", ex.what()), Misc::Logger::LogLevel::Caution);
+    }
+#endif
+}
 
 void Network::Protocol::UDP::ReceiveMessage()
 {
-    std::string address = "";
-    std::uint16_t port = 0;
+#ifdef USE_IO_URING
+    if (_receiver) {
+        const std::int32_t count = _receiver->ReceiveFrom(_datagrams, POLL_TIMEOUT_MS);
 
-    const std::vector<std::uint8_t> content = Wrapper::Socket::ReceiveFrom(_socket, address, port);
-    const std::size_t size = content.size();
+        for (const Wrapper::Socket::Datagram& datagram : _datagrams) {
+            HandleDatagram(datagram.endpoint, datagram.data.data(), datagram.data.size());
+        }
+        if (count >= 0) {
+            return;
+        }
+        Misc::Logger::Log(std::format("Falling back to system calls for received datagrams: {}", Wrapper::Socket::GetLastError()), Misc::Logger::LogLevel::Caution);
+        _receiver.reset();
+    }
+#endif
+    std::vector<Wrapper::Socket::PollType> sockets = {{
+        .fd = _socket,
+        .events = POLLIN,
+        .revents = 0
+    }};
+
+    if (Wrapper::Socket::Poll(sockets, POLL_TIMEOUT_MS) < 0) {
+        throw Exception::GenericError(std::format("Poll error: {}", Wrapper::Socket::GetLastError()));
+    }
 
-    if (size > 0) {
-        const ActionType type = static_cast<ActionType>(content[0]);
-        std::vector<std::uint8_t> payload = {};
+    if (sockets[0].revents & POLLIN) {
+        std::int32_t count = 0;
 
-        if (size > 1) {
-            payload.assign(content.begin() + 1, content.end());
-        }
+        do {
+            count = _batch.Receive(_socket);
+            if (count < 0) {
+                throw Exception::GenericError(std::format("Receive error: {}", Wrapper::Socket::GetLastError()));
+            }
+            for (std::int32_t i = 0; i < count; i++) {
+                HandleDatagram(_batch.GetEndpoint(i), _batch.GetData(i), _batch.GetSize(i));
+            }
+        } while (static_cast<std::size_t>(count) == _batch.GetCapacity());
+    }
+}
 
-        const std::shared_ptr<Network::Player> player = Storage::Cache::Player::GetInstance().GetPlayerByAddress(address, port);
+void Network::Protocol::UDP::HandleDatagram(const struct sockaddr_in& endpoint, const std::uint8_t* data, const std::size_t size)
+{
+    if (size > 0) {
+        const ActionType type = static_cast<ActionType>(data[0]);
+        const std::vector<std::uint8_t> payload(data + 1, data + size);
+        const std::shared_ptr<Network::Player> player = Storage::Cache::Player::GetInstance().GetPlayerByEndpoint(Wrapper::Socket::ToKey(endpoint));
 
         if (player) {
             Action::Dispatcher::ReceiveMessage(type, player->GetId(), payload);
@@ -46,26 +93,129 @@ void Network::Protocol::UDP::SendMessage(const Wrapper::Socket::SocketType socke
     const std::shared_ptr<Network::Player> player = Storage::Cache::Player::GetInstance().GetPlayerBySocket(socket);
 
     if (player) {
-        const std::string& address = player->GetAddress();
-        const std::uint16_t port = player->GetPort();
+        _bundle.assign(1, static_cast<std::uint8_t>(ActionType::BDL));
+        _bundled = 0;
 
         while (player->HasMessage(Wrapper::Socket::Protocol::UDP)) {
             const Network::Player::Message message = player->PopMessage(Wrapper::Socket::Protocol::UDP);
+            const std::size_t size = HEADER_TYPE_SIZE + HEADER_BUNDLE_LENGTH_SIZE + message.body.size();
+
+            if (HEADER_TYPE_SIZE + size > UDP_BUNDLE_SIZE) {
+                Seal(*player);
+                Fragment(*player, message);
+                continue;
+            }
+            if (_bundle.size() + size > UDP_BUNDLE_SIZE) {
+                Seal(*player);
+            }
 
-            std::vector<std::uint8_t> content = {};
-            content.reserve(1 + message.body.size());
+            const std::vector<std::uint8_t> length = Misc::Utils::Serialize<std::uint16_t>(static_cast<std::uint16_t>(message.body.size()));
 
+            _bundle.push_back(static_cast<std::uint8_t>(message.type));
+            _bundle.insert(_bundle.end(), length.begin(), length.end());
+            _bundle.insert(_bundle.end(), message.body.begin(), message.body.end());
+            _bundled++;
+        }
+        Seal(*player);
+    }
+}
+
+void Network::Protocol::UDP::Seal(const Network::Player& player)
+{
+    if (_bundled == 1) {
+        std::vector<std::uint8_t> content = {};
+
+        content.reserve(_bundle.size() - HEADER_TYPE_SIZE - HEADER_BUNDLE_LENGTH_SIZE);
+        content.push_back(_bundle[HEADER_TYPE_SIZE]);
+        content.insert(content.end(), _bundle.begin() + 2 * HEADER_TYPE_SIZE + HEADER_BUNDLE_LENGTH_SIZE, _bundle.end());
+        Emit(player, content);
+    } else if (_bundled > 1) {
+        Emit(player, _bundle);
+    }
+    _bundle.resize(HEADER_TYPE_SIZE);
+    _bundled = 0;
+}
+
+void Network::Protocol::UDP::Fragment(Network::Player& player, const Network::Player::Message& message)
+{
+    constexpr std::size_t header = HEADER_TYPE_SIZE + HEADER_SEQUENCE_SIZE + 2 * HEADER_FRAGMENTS_SIZE;
+    constexpr std::size_t wrapper = 2 * HEADER_TYPE_SIZE + HEADER_BUNDLE_LENGTH_SIZE + HEADER_SEQUENCE_SIZE;
+    const bool reliable = message.type != ActionType::REL;
+    const std::size_t capacity = UDP_BUNDLE_SIZE - header - (reliable ? wrapper : 0);
+    const std::size_t total = HEADER_TYPE_SIZE + message.body.size();
+    const std::size_t count = (total + capacity - 1) / capacity;
+
+    if (count > std::numeric_limits<std::uint16_t>::max()) {
+        Misc::Logger::Log(std::format("Dropping message to player {}: {} bytes is too large to fragment", player.GetId(), total), Misc::Logger::LogLevel::Critical);
+        return;
+    }
+
+    const std::uint32_t sequence = ++_sequence;
+    std::vector<std::uint8_t> content = {};
+
+    content.reserve(UDP_BUNDLE_SIZE);
+    for (std::size_t index = 0; index < count; index++) {
+        const std::size_t begin = index * capacity;
+        const std::size_t end = std::min(begin + capacity, total);
+        const std::vector<std::uint8_t> fields = Misc::Utils::Serialize(sequence, static_cast<std::uint16_t>(index), static_cast<std::uint16_t>(count));
+
+        content.assign(1, static_cast<std::uint8_t>(ActionType::FRG));
+        content.insert(content.end(), fields.begin(), fields.end());
+        if (begin == 0) {
             content.push_back(static_cast<std::uint8_t>(message.type));
+            content.insert(content.end(), message.body.begin(), message.body.begin() + static_cast<std::ptrdiff_t>(end - HEADER_TYPE_SIZE));
+        } else {
+            content.insert(content.end(), message.body.begin() + static_cast<std::ptrdiff_t>(begin - HEADER_TYPE_SIZE), message.body.begin() + static_cast<std::ptrdiff_t>(end - HEADER_TYPE_SIZE));
+        }
+        if (reliable) {
+            player.PushReliable({ .type = ActionType::FRG, .body = std::vector<std::uint8_t>(content.begin() + HEADER_TYPE_SIZE, content.end()) });
+        } else {
+            Emit(player, content);
+        }
+    }
+}
 
-            if (!message.body.empty()) {
-                content.insert(content.end(), message.body.begin(), message.body.end());
-            }
+void Network::Protocol::UDP::Emit(const Network::Player& player, const std::vector<std::uint8_t>& content)
+{
+    const struct sockaddr_in& endpoint = player.GetEndpoint();
 
-            if (Wrapper::Socket::SendTo(_socket, content, address, port) < 0) {
-                Misc::Logger::Log(std::format("Failed to send message to player {}: {}", player->GetId(), Wrapper::Socket::GetLastError()), Misc::Logger::LogLevel::Critical);
-            } else {
-                Misc::Logger::Log(std::format("Sent message to player {}: {}", player->GetId(), Misc::Utils::BytesToHex(content)), Misc::Logger::LogLevel::Network);
-            }
+#ifdef USE_IO_URING
+    if (_sender) {
+        if (!_sender->SendTo(content, endpoint)) {
+            Misc::Logger::Log(std::format("Failed to queue message to player {}: {}", player.GetId(), Wrapper::Socket::GetLastError()), Misc::Logger::LogLevel::Critical);
+        }
+        return;
+    }
+#endif
+    if (_outgoing.GetCount() == _outgoing.GetCapacity()) {
+        Flush();
+    }
+    if (_outgoing.Push(content, endpoint)) {
+        Misc::Logger::Log(std::format("Queued message to player {}: {}", player.GetId(), Misc::Utils::BytesToHex(content)), Misc::Logger::LogLevel::Network);
+        return;
+    }
+    if (Wrapper::Socket::SendTo(_socket, content, endpoint) < 0) {
+        Misc::Logger::Log(std::format("Failed to send message to player {}: {}", player.GetId(), Wrapper::Socket::GetLastError()), Misc::Logger::LogLevel::Critical);
+    } else {
+        Misc::Logger::Log(std::format("Sent message to player {}: {}", player.GetId(), Misc::Utils::BytesToHex(content)), Misc::Logger::LogLevel::Network);
+    }
+}
+
+void Network::Protocol::UDP::Flush()
+{
+#ifdef USE_IO_URING
+    if (_sender && _sender->Flush() < 0) {
+        Misc::Logger::Log(std::format("Failed to submit queued messages: {}", Wrapper::Socket::GetLastError()), Misc::Logger::LogLevel::Critical);
+    }
+#endif
+    if (_outgoing.GetCount() > 0) {
+        const std::size_t count = _outgoing.GetCount();
+        const std::size_t dropped = _outgoing.Send(_socket);
+
+        if (dropped > 0) {
+            Misc::Logger::Log(std::format("Failed to send {} of {} queued messages: {}", dropped, count, Wrapper::Socket::GetLastError()), Misc::Logger::LogLevel::Critical);
+        } else {
+            Misc::Logger::Log(std::format("Sent {} queued messages", count), Misc::Logger::LogLevel::Network);
         }
     }
 }
@@ -0,0 +1,69 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Reliable.cpp
+*/
+
+#include "Miscellaneous/Utils.hpp"
+#include "Network/Reliable.hpp"
+#include "Variables.hpp"
+
+#include <algorithm>
+
+Network::Reliable::Reliable() : _sequence(0)
+{
+}
+
+std::vector<std::uint8_t> Network::Reliable::Push(const ActionType type, const std::vector<std::uint8_t>& body)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::vector<std::uint8_t> content = Misc::Utils::Serialize(++_sequence, type);
+
+    content.insert(content.end(), body.begin(), body.end());
+    _pending.push_back({ .sequence = _sequence, .body = content, .clock = Misc::Clock(), .sends = 1 });
+    return content;
+}
+
+void Network::Reliable::Acknowledge(const std::uint32_t latest, const std::uint32_t mask)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (static_cast<std::int32_t>(latest - _sequence) > 0) {
+        return;
+    }
+    std::erase_if(_pending, [latest, mask](const Pending& pending) {
+        const std::int32_t distance = static_cast<std::int32_t>(pending.sequence - latest);
+
+        return distance <= 0 || (distance <= RELIABLE_ACK_BITS && (mask >> (distance - 1)) & 1);
+    });
+}
+
+void Network::Reliable::Clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _pending.clear();
+    _sequence = 0;
+}
+
+void Network::Reliable::Collect(std::vector<std::vector<std::uint8_t>>& due)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    due.clear();
+    for (Pending& pending : _pending) {
+        if (pending.sends < RELIABLE_REDUNDANCY || pending.clock.HasElapsed(RELIABLE_RESEND_MS)) {
+            due.push_back(pending.body);
+            pending.clock.Reset();
+            pending.sends = static_cast<std::uint8_t>(std::min<std::uint32_t>(pending.sends + 1, RELIABLE_REDUNDANCY));
+        }
+    }
+}
+
+bool Network::Reliable::IsFull() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    return _pending.size() >= MAX_RELIABLE_PENDING;
+}
@@ -12,47 +12,64 @@
 #include "Exception/Generic.hpp"
 #include "Action/Dispatcher.hpp"
 #include "Action/List/DFY.hpp"
+#include "Network/Outbox.hpp"
 #include "Storage/Player.hpp"
 #include "Storage/Game.hpp"
 #include "Variables.hpp"
 
 #include <format>
 #include <thread>
-#include <chrono>
 
-Network::Transceiver::Transceiver()
+Network::Transceiver::Transceiver() : _steered(false)
 {
     if (!Wrapper::Socket::Initialize()) {
         throw Exception::GenericError(std::format("Failed to initialize socket library: {}", Wrapper::Socket::GetLastError()));
     }
 
-    _sockets = {
-        .udp = CreateSocket(Wrapper::Socket::Protocol::UDP),
-        .tcp = CreateSocket(Wrapper::Socket::Protocol::TCP)
-    };
-
-    _managers = {
-        .udp = std::make_unique<Protocol::UDP>(_sockets.udp),
-        .tcp = std::make_unique<Protocol::TCP>()
-    };
+#ifdef SO_REUSEPORT
+    const std::uint16_t receivers = Misc::Env::GetInstance().GetConfiguration<Misc::Env::Server>().receivers;
+#else
+    const std::uint16_t receivers = 1;
+#endif
+
+    _spare = Wrapper::Socket::Create(Wrapper::Socket::Protocol::UDP);
+    _sockets.tcp = CreateSocket(Wrapper::Socket::Protocol::TCP);
+    _managers.tcp = std::make_unique<Protocol::TCP>();
+    for (std::uint16_t i = 0; i < receivers; i++) {
+        _sockets.udp.push_back(CreateSocket(Wrapper::Socket::Protocol::UDP));
+        _managers.udp.push_back(std::make_unique<Protocol::UDP>(_sockets.udp.back()));
+    }
+    _steered = receivers > 1 && receivers <= std::thread::hardware_concurrency() && Wrapper::Socket::SetSteering(_sockets.udp.front(), receivers);
+    if (receivers > 1 && !_steered) {
+        Misc::Logger::Log(std::format("Datagrams are spread over {} sockets by the kernel hash", receivers), Misc::Logger::LogLevel::Caution);
+    }
 
     Misc::Logger::Log(std::format("Server started on port {}", Misc::Env::GetInstance().GetConfiguration<Misc::Env::Server>().port));
 
+    if (!Wrapper::Socket::SetNonBlocking(_sockets.tcp) || !_poller.Add(_sockets.tcp, true)) {
+        throw Exception::GenericError(std::format("Failed to register listening socket: {}", Wrapper::Socket::GetLastError()));
+    }
+
     _clients.push_back({
         .fd = _sockets.tcp,
         .events = POLLIN,
         .revents = 0
     });
 
-    _clients.push_back({
-        .fd = _sockets.udp,
-        .events = POLLIN,
-        .revents = 0
-    });
+    for (const Wrapper::Socket::SocketType& socket : _sockets.udp) {
+        _clients.push_back({
+            .fd = socket,
+            .events = POLLIN,
+            .revents = 0
+        });
+    }
 }
 
 Network::Transceiver::~Transceiver()
 {
+    if (Wrapper::Socket::IsValid(_spare)) {
+        Wrapper::Socket::Close(_spare);
+    }
     Wrapper::Socket::Cleanup();
 
     Misc::Logger::Log("Server stopped");
@@ -60,75 +77,49 @@ Network::Transceiver::~Transceiver()
 
 void Network::Transceiver::SecureReceive(const std::atomic<bool>& running)
 {
+    std::vector<Wrapper::Poller::Event> events = {};
+
+    events.reserve(MAX_POLL_EVENTS);
     while (running.load()) {
         try {
             std::vector<Wrapper::Socket::SocketType> disconnected = {};
-            std::vector<Wrapper::Socket::SocketType> clients = {};
-            std::vector<Wrapper::Socket::PollType> sockets = {};
-
-            {
-                std::shared_lock<std::shared_mutex> lock(_mutex);
-                sockets.push_back({
-                    .fd = _sockets.tcp,
-                    .events = POLLIN,
-                    .revents = 0
-                });
-
-                for (const auto& client : _clients) {
-                    if (client.fd != _sockets.tcp && client.fd != _sockets.udp) {
-                        sockets.push_back(client);
-                    }
-                }
-            }
-
-            if (sockets.empty()) {
-                continue;
-            }
 
-            if (Wrapper::Socket::Poll(sockets, POLL_TIMEOUT_MS) < 0) {
+            if (_poller.Wait(events, POLL_TIMEOUT_MS) < 0) {
                 throw Exception::GenericError(std::format("Poll error: {}", Wrapper::Socket::GetLastError()));
             }
 
-            for (const auto& socket : sockets) {
-                if (socket.revents & (POLLHUP | POLLERR | POLLNVAL)) {
-                    if (socket.fd != _sockets.tcp) {
-                        disconnected.push_back(socket.fd);
+            for (const auto& event : events) {
+                if (event.socket == _sockets.tcp) {
+                    for (auto accepted = HandleConnection(); accepted.has_value(); accepted = HandleConnection()) {
+                        std::unique_lock<std::shared_mutex> lock(_mutex);
+                        _clients.push_back({
+                            .fd = accepted.value(),
+                            .events = POLLIN,
+                            .revents = 0
+                        });
                     }
                     continue;
                 }
 
-                if (socket.revents & POLLIN) {
-                    if (socket.fd == _sockets.tcp) {
-                        if (auto accepted = HandleConnection(); accepted.has_value()) {
-                            clients.push_back(accepted.value());
-                        }
-                        continue;
-                    }
+                if (event.hangup) {
+                    disconnected.push_back(event.socket);
+                    continue;
+                }
 
-                    std::optional<std::uint32_t> id = Storage::Cache::Player::GetInstance().GetPlayerIdBySocket(socket.fd);
+                if (event.readable) {
+                    std::optional<std::uint32_t> id = Storage::Cache::Player::GetInstance().GetPlayerIdBySocket(event.socket);
                     if (!id.has_value()) {
-                        Misc::Logger::Log(std::format("Unregistered socket {} received activity, cleaning up", socket.fd), Misc::Logger::LogLevel::Caution);
-                        disconnected.push_back(socket.fd);
+                        Misc::Logger::Log(std::format("Unregistered socket {} received activity, cleaning up", event.socket), Misc::Logger::LogLevel::Caution);
+                        disconnected.push_back(event.socket);
                         continue;
                     }
 
-                    if (_managers.tcp->ReceiveMessage(socket.fd)) {
-                        disconnected.push_back(socket.fd);
+                    if (_managers.tcp->ReceiveMessage(event.socket)) {
+                        disconnected.push_back(event.socket);
                     }
                 }
             }
 
-            if (!clients.empty()) {
-                std::unique_lock<std::shared_mutex> lock(_mutex);
-                for (const auto& fd : clients) {
-                    _clients.push_back({
-                        .fd = fd,
-                        .events = POLLIN,
-                        .revents = 0
-                    });
-                }
-            }
-
             for (const auto& socket : disconnected) {
                 HandleDisconnection(socket);
             }
@@ -142,21 +133,22 @@ void Network::Transceiver::SecureReceive(const std::atomic<bool>& running)
 
 void Network::Transceiver::SecureSend(const std::atomic<bool>& running)
 {
+    std::vector<std::uint32_t> ready = {};
+
     while (running.load()) {
         try {
-            std::vector<Wrapper::Socket::SocketType> sockets = {};
-            {
-                std::shared_lock<std::shared_mutex> lock(_mutex);
-                for (const auto& client : _clients) {
-                    if (client.fd != _sockets.tcp && client.fd != _sockets.udp) {
-                        sockets.push_back(client.fd);
+            const std::uint32_t timeout = _managers.tcp->HasPending() ? TCP_RETRY_INTERVAL_MS : POLL_TIMEOUT_MS;
+
+            if (Network::Outbox::GetInstance().Wait(Wrapper::Socket::Protocol::TCP, ready, timeout)) {
+                for (const std::uint32_t& id : ready) {
+                    const std::optional<Wrapper::Socket::SocketType> socket = Storage::Cache::Player::GetInstance().GetSocketByPlayerId(id);
+
+                    if (socket.has_value()) {
+                        _managers.tcp->SendMessage(socket.value());
                     }
                 }
             }
-
-            for (const auto& socket : sockets) {
-                _managers.tcp->SendMessage(socket);
-            }
+            _managers.tcp->Flush();
         } catch (const std::exception& ex) {
             Misc::Logger::Log(std::format("Secure send error: {}", ex.what()), Misc::Logger::LogLevel::Critical);
         } catch (...) {
@@ -165,31 +157,11 @@ void Network::Transceiver::SecureSend(const std::atomic<bool>& running)
     }
 }
 
-void Network::Transceiver::Receive(const std::atomic<bool>& running)
+void Network::Transceiver::Receive(const std::atomic<bool>& running, const std::size_t shard)
 {
     while (running.load()) {
         try {
-            std::vector<Wrapper::Socket::PollType> sockets = {{
-                .fd = _sockets.udp,
-                .events = POLLIN,
-                .revents = 0
-            }};
-
-            if (Wrapper::Socket::Poll(sockets, POLL_TIMEOUT_MS) < 0) {
-                throw Exception::GenericError(std::format("Poll error: {}", Wrapper::Socket::GetLastError()));
-            }
-
-            bool activity = false;
-            for (const auto& socket : sockets) {
-                if (socket.revents & POLLIN) {
-                    _managers.udp->ReceiveMessage();
-                    activity = true;
-                }
-            }
-
-            if (!activity) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(1));
-            }
+            _managers.udp[shard]->ReceiveMessage();
         } catch (const std::exception& ex) {
             Misc::Logger::Log(std::format("Receive error: {}", ex.what()), Misc::Logger::LogLevel::Critical);
         } catch (...) {
@@ -200,21 +172,22 @@ void Network::Transceiver::Receive(const std::atomic<bool>& running)
 
 void Network::Transceiver::Send(const std::atomic<bool>& running)
 {
+    std::vector<std::uint32_t> ready = {};
+
     while (running.load()) {
         try {
-            std::vector<Wrapper::Socket::SocketType> sockets = {};
-            {
-                std::shared_lock<std::shared_mutex> lock(_mutex);
-                for (const auto& client : _clients) {
-                    if (client.fd != _sockets.tcp && client.fd != _sockets.udp) {
-                        sockets.push_back(client.fd);
-                    }
-                }
+            if (!Network::Outbox::GetInstance().Wait(Wrapper::Socket::Protocol::UDP, ready, POLL_TIMEOUT_MS)) {
+                continue;
             }
 
-            for (const auto& socket : sockets) {
-                _managers.udp->SendMessage(socket);
+            for (const std::uint32_t& id : ready) {
+                const std::optional<Wrapper::Socket::SocketType> socket = Storage::Cache::Player::GetInstance().GetSocketByPlayerId(id);
+
+                if (socket.has_value()) {
+                    _managers.udp.front()->SendMessage(socket.value());
+                }
             }
+            _managers.udp.front()->Flush();
         } catch (const std::exception& ex) {
             Misc::Logger::Log(std::format("Send error: {}", ex.what()), Misc::Logger::LogLevel::Critical);
         } catch (...) {
@@ -229,17 +202,34 @@ std::optional<Wrapper::Socket::SocketType> Network::Transceiver::HandleConnectio
     std::optional<std::reference_wrapper<std::pair<std::string, std::uint16_t>>> opt(std::ref(addr));
     Wrapper::Socket::SocketType socket = Wrapper::Socket::Accept(_sockets.tcp, opt);
 
-    if (!Wrapper::Socket::IsValid(socket)) {
+    while (!Wrapper::Socket::IsValid(socket) && Wrapper::Socket::IsExhausted() && RefuseConnection()) {
+        socket = Wrapper::Socket::Accept(_sockets.tcp, opt);
+    }
+    if (!Wrapper::Socket::IsValid(socket) && Wrapper::Socket::WouldBlock()) {
+        return std::nullopt;
+    } else if (!Wrapper::Socket::IsValid(socket)) {
         Misc::Logger::Log(std::format("Failed to accept new connection: {}", Wrapper::Socket::GetLastError()), Misc::Logger::LogLevel::Critical);
         return std::nullopt;
     }
 
+    if (!Wrapper::Socket::SetNoDelay(socket)) {
+        Misc::Logger::Log(std::format("Failed to disable delayed sends on socket {}: {}", socket, Wrapper::Socket::GetLastError()), Misc::Logger::LogLevel::Caution);
+    }
+    if (!Wrapper::Socket::SetNonBlocking(socket)) {
+        Misc::Logger::Log(std::format("Failed to make socket {} non-blocking: {}", socket, Wrapper::Socket::GetLastError()), Misc::Logger::LogLevel::Critical);
+        Wrapper::Socket::Close(socket);
+        return std::nullopt;
+    }
+
     const std::shared_ptr<Network::Player> player = std::make_shared<Network::Player>(addr.first, addr.second);
 
     if (player) {
         const std::uint32_t id = player->GetId();
 
         Storage::Cache::Player::GetInstance().AddPlayer(socket, player);
+        if (!_poller.Add(socket, true)) {
+            Misc::Logger::Log(std::format("Failed to watch socket {}: {}", socket, Wrapper::Socket::GetLastError()), Misc::Logger::LogLevel::Critical);
+        }
         Action::Dispatcher::SendMessage(ActionType::DFY, id, Action::List::DFY::State::RequestCredentials);
 
         return socket;
@@ -251,15 +241,16 @@ void Network::Transceiver::HandleDisconnection(const Wrapper::Socket::SocketType
 {
     std::optional<std::uint32_t> id = Storage::Cache::Player::GetInstance().GetPlayerIdBySocket(socket);
 
+    _managers.tcp->Release(socket);
     if (id.has_value()) {
         const std::shared_ptr<Engine::Game>& game = Storage::Cache::Game::GetInstance().GetGameByPlayerId(id.value());
 
         if (game) {
-            game->RemovePlayerId(id.value());
-            Storage::Cache::Game::GetInstance().RemovePlayerFromGame(id.value());
+            game->Push({ .type = Engine::Game::Command::Type::Leave, .player = id.value(), .value = 0 });
         }
 
         Storage::Cache::Player::GetInstance().RemovePlayer(socket);
+        _poller.Remove(socket);
         Wrapper::Socket::Close(socket);
     } else {
         Misc::Logger::Log(std::format("Disconnection of unknown client on socket {}", socket), Misc::Logger::LogLevel::Caution);
@@ -301,7 +292,35 @@ Wrapper::Socket::SocketType Network::Transceiver::GetSecureSocket() const
 
 Wrapper::Socket::SocketType Network::Transceiver::GetSocket() const
 {
-    return _sockets.udp;
+    return _sockets.udp.front();
+}
+
+bool Network::Transceiver::RefuseConnection()
+{
+    if (!Wrapper::Socket::IsValid(_spare)) {
+        return false;
+    }
+    Wrapper::Socket::Close(_spare);
+
+    const Wrapper::Socket::SocketType socket = Wrapper::Socket::Accept(_sockets.tcp);
+    const bool refused = Wrapper::Socket::IsValid(socket);
+
+    if (refused) {
+        Wrapper::Socket::Close(socket);
+        Misc::Logger::Log("Out of descriptors, refused a pending connection", Misc::Logger::LogLevel::Caution);
+    }
+    _spare = Wrapper::Socket::Create(Wrapper::Socket::Protocol::UDP);
+    return refused;
+}
+
+std::size_t Network::Transceiver::GetShardCount() const
+{
+    return _sockets.udp.size();
+}
+
+bool Network::Transceiver::IsSteered() const
+{
+    return _steered;
 }
 
 const std::vector<Wrapper::Socket::PollType>& Network::Transceiver::GetClients() const
@@ -68,6 +68,12 @@ void Storage::Cache::Game::AddPlayerToGame(const std::uint32_t playerId, const s
     _playerToGame[playerId] = gameId;
 }
 
+bool Storage::Cache::Game::TryAddPlayerToGame(const std::uint32_t playerId, const std::uint32_t gameId)
+{
+    std::unique_lock<std::shared_mutex> lock(_mutex);
+    return _playerToGame.try_emplace(playerId, gameId).second;
+}
+
 void Storage::Cache::Game::RemovePlayerFromGame(const std::uint32_t playerId)
 {
     std::unique_lock<std::shared_mutex> lock(_mutex);
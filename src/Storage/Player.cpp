@@ -10,26 +10,13 @@
 #include "Storage/Player.hpp"
 
 #include <shared_mutex>
-#include <format>
-
-const Storage::Cache::Player::SocketToPlayerMap& Storage::Cache::Player::GetSocketToPlayerMap() const
-{
-    std::shared_lock<std::shared_mutex> lock(_mutex);
-    return _socketToPlayer;
-}
-
-const Storage::Cache::Player::IdToPlayerMap& Storage::Cache::Player::GetIdToPlayerMap() const
-{
-    std::shared_lock<std::shared_mutex> lock(_mutex);
-    return _idToPlayer;
-}
 
 const std::shared_ptr<Network::Player> Storage::Cache::Player::GetPlayerBySocket(const Wrapper::Socket::SocketType socket) const
 {
     std::shared_lock<std::shared_mutex> lock(_mutex);
-    auto it = _socketToPlayer.find(socket);
-    if (it != _socketToPlayer.end()) {
-        return it->second;
+    const Slot* slot = FindBySocket(socket);
+    if (slot) {
+        return slot->player;
     }
     return nullptr;
 }
@@ -37,19 +24,19 @@ const std::shared_ptr<Network::Player> Storage::Cache::Player::GetPlayerBySocket
 const std::shared_ptr<Network::Player> Storage::Cache::Player::GetPlayerById(const std::uint32_t id) const
 {
     std::shared_lock<std::shared_mutex> lock(_mutex);
-    auto it = _idToPlayer.find(id);
-    if (it != _idToPlayer.end()) {
-        return it->second;
+    const Slot* slot = FindById(id);
+    if (slot) {
+        return slot->player;
     }
     return nullptr;
 }
 
-const std::shared_ptr<Network::Player> Storage::Cache::Player::GetPlayerByAddress(const std::string& address, const std::uint16_t port) const
+const std::shared_ptr<Network::Player> Storage::Cache::Player::GetPlayerByEndpoint(const Wrapper::Socket::EndpointKey key) const
 {
-    std::shared_lock<std::shared_mutex> lock(_mutex);
-    auto it = _addressToPlayer.find(std::format("{}:{}", address, port));
-    if (it != _addressToPlayer.end()) {
-        return it->second;
+    std::shared_lock<std::shared_mutex> lock(_endpointMutex);
+    const std::shared_ptr<Network::Player>* player = _endpointToPlayer.Find(key);
+    if (player) {
+        return *player;
     }
     return nullptr;
 }
@@ -57,9 +44,9 @@ const std::shared_ptr<Network::Player> Storage::Cache::Player::GetPlayerByAddres
 std::optional<Wrapper::Socket::SocketType> Storage::Cache::Player::GetSocketByPlayerId(const std::uint32_t id) const
 {
     std::shared_lock<std::shared_mutex> lock(_mutex);
-    auto it = _idToSocket.find(id);
-    if (it != _idToSocket.end()) {
-        return it->second;
+    const Slot* slot = FindById(id);
+    if (slot) {
+        return slot->socket;
     }
     return std::nullopt;
 }
@@ -67,9 +54,9 @@ std::optional<Wrapper::Socket::SocketType> Storage::Cache::Player::GetSocketByPl
 std::optional<std::uint32_t> Storage::Cache::Player::GetPlayerIdBySocket(const Wrapper::Socket::SocketType socket) const
 {
     std::shared_lock<std::shared_mutex> lock(_mutex);
-    auto it = _socketToPlayer.find(socket);
-    if (it != _socketToPlayer.end()) {
-        return it->second->GetId();
+    const Slot* slot = FindBySocket(socket);
+    if (slot) {
+        return slot->id;
     }
     return std::nullopt;
 }
@@ -77,32 +64,88 @@ std::optional<std::uint32_t> Storage::Cache::Player::GetPlayerIdBySocket(const W
 void Storage::Cache::Player::AddPlayer(const Wrapper::Socket::SocketType socket, std::shared_ptr<Network::Player> player)
 {
     std::unique_lock<std::shared_mutex> lock(_mutex);
-    if (_socketToPlayer.find(socket) != _socketToPlayer.end()) {
+    if (FindBySocket(socket)) {
         throw Exception::Socket::AlreadyRegisteredError(socket);
     }
-    const std::string address = std::format("{}:{}", player->GetAddress(), player->GetPort());
+    const Wrapper::Socket::EndpointKey key = Wrapper::Socket::ToKey(player->GetEndpoint());
+    const std::size_t descriptor = static_cast<std::size_t>(socket);
     const std::uint32_t id = player->GetId();
+    std::uint32_t index = static_cast<std::uint32_t>(_slots.size());
+
+    if (!_free.empty()) {
+        index = _free.back();
+        _free.pop_back();
+    } else {
+        _slots.emplace_back();
+    }
+
+    Slot& slot = _slots[index];
 
-    _addressToPlayer.emplace(address, player);
-    _socketToPlayer.emplace(socket, player);
-    _idToPlayer.emplace(id, player);
-    _idToSocket.emplace(id, socket);
+    slot.generation++;
+    slot.player = player;
+    slot.socket = socket;
+    slot.id = id;
+
+    if (descriptor >= _sockets.size()) {
+        _sockets.resize(descriptor + 1);
+    }
+    _sockets[descriptor] = { .slot = index, .generation = slot.generation };
+    _ids.Insert(id, { .slot = index, .generation = slot.generation });
+    {
+        std::unique_lock<std::shared_mutex> endpointLock(_endpointMutex);
+        _endpointToPlayer.Insert(key, player);
+    }
 }
 
 std::uint32_t Storage::Cache::Player::RemovePlayer(const Wrapper::Socket::SocketType socket)
 {
     std::unique_lock<std::shared_mutex> lock(_mutex);
-    auto it = _socketToPlayer.find(socket);
-    if (it != _socketToPlayer.end()) {
-        const std::string address = std::format("{}:{}", it->second->GetAddress(), it->second->GetPort());
-        const std::uint32_t id = it->second->GetId();
+    const Slot* found = FindBySocket(socket);
+    if (found) {
+        const std::uint32_t index = _sockets[static_cast<std::size_t>(socket)].slot;
+        Slot& slot = _slots[index];
+        const Wrapper::Socket::EndpointKey key = Wrapper::Socket::ToKey(slot.player->GetEndpoint());
+        const std::uint32_t id = slot.id;
 
-        _addressToPlayer.erase(address);
-        _socketToPlayer.erase(socket);
-        _idToPlayer.erase(id);
-        _idToSocket.erase(id);
+        {
+            std::unique_lock<std::shared_mutex> endpointLock(_endpointMutex);
+            _endpointToPlayer.Erase(key);
+        }
+        _ids.Erase(id);
+        _sockets[static_cast<std::size_t>(socket)] = {};
+        slot.player.reset();
+        slot.generation++;
+        _free.push_back(index);
 
         return id;
     }
     throw Exception::Socket::NotRegisteredError(socket);
 }
+
+const Storage::Cache::Player::Slot* Storage::Cache::Player::Resolve(const Handle& handle) const
+{
+    if (handle.generation != 0 && handle.slot < _slots.size() && _slots[handle.slot].generation == handle.generation) {
+        return &_slots[handle.slot];
+    }
+    return nullptr;
+}
+
+const Storage::Cache::Player::Slot* Storage::Cache::Player::FindBySocket(const Wrapper::Socket::SocketType socket) const
+{
+    const std::size_t descriptor = static_cast<std::size_t>(socket);
+
+    if (descriptor < _sockets.size()) {
+        return Resolve(_sockets[descriptor]);
+    }
+    return nullptr;
+}
+
+const Storage::Cache::Player::Slot* Storage::Cache::Player::FindById(const std::uint32_t id) const
+{
+    const Handle* handle = _ids.Find(id);
+
+    if (handle) {
+        return Resolve(*handle);
+    }
+    return nullptr;
+}
@@ -0,0 +1,140 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Batch.cpp
+*/
+
+#include "Wrapper/Batch.hpp"
+#include "Variables.hpp"
+
+#include <cstring>
+#include <cerrno>
+
+Wrapper::Batch::Batch(const std::size_t count) : _storage(count * UDP_PACKET_SIZE), _addresses(count), _sizes(count, 0), _count(0)
+{
+#ifdef __linux__
+    _headers.resize(count);
+    _vectors.resize(count);
+    for (std::size_t i = 0; i < count; i++) {
+        _vectors[i] = { .iov_base = _storage.data() + i * UDP_PACKET_SIZE, .iov_len = UDP_PACKET_SIZE };
+        _headers[i] = {};
+        _headers[i].msg_hdr.msg_iov = &_vectors[i];
+        _headers[i].msg_hdr.msg_iovlen = 1;
+        _headers[i].msg_hdr.msg_name = &_addresses[i];
+    }
+#endif
+}
+
+std::int32_t Wrapper::Batch::Receive(const Socket::SocketType& sock)
+{
+#ifdef __linux__
+    for (std::size_t i = 0; i < _headers.size(); i++) {
+        _headers[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+        _headers[i].msg_hdr.msg_flags = 0;
+    }
+
+    const std::int32_t count = recvmmsg(sock, _headers.data(), static_cast<std::uint32_t>(_headers.size()), MSG_DONTWAIT, nullptr);
+
+    if (count < 0) {
+        return Socket::WouldBlock() ? 0 : -1;
+    }
+    for (std::int32_t i = 0; i < count; i++) {
+        _sizes[i] = (_headers[i].msg_hdr.msg_flags & MSG_TRUNC) ? 0 : _headers[i].msg_len;
+    }
+    return count;
+#else
+    socklen_t length = sizeof(struct sockaddr_in);
+
+#ifdef _WIN32
+    const std::int32_t bytes = recvfrom(sock, reinterpret_cast<char*>(_storage.data()), UDP_PACKET_SIZE, 0, reinterpret_cast<struct sockaddr*>(&_addresses[0]), &length);
+#else
+    const ssize_t bytes = recvfrom(sock, _storage.data(), UDP_PACKET_SIZE, MSG_DONTWAIT, reinterpret_cast<struct sockaddr*>(&_addresses[0]), &length);
+#endif
+
+    if (bytes < 0) {
+        return Socket::WouldBlock() ? 0 : -1;
+    }
+    _sizes[0] = static_cast<std::size_t>(bytes);
+    return 1;
+#endif
+}
+
+bool Wrapper::Batch::Push(const std::vector<std::uint8_t>& data, const struct sockaddr_in& endpoint)
+{
+    if (_count >= _sizes.size() || data.empty() || data.size() > UDP_PACKET_SIZE) {
+        return false;
+    }
+    std::memcpy(_storage.data() + _count * UDP_PACKET_SIZE, data.data(), data.size());
+    _addresses[_count] = endpoint;
+    _sizes[_count] = data.size();
+    _count++;
+    return true;
+}
+
+std::size_t Wrapper::Batch::Send(const Socket::SocketType& sock)
+{
+    const std::size_t count = _count;
+    std::size_t dropped = 0;
+    std::size_t sent = 0;
+
+    _count = 0;
+#ifdef __linux__
+    for (std::size_t i = 0; i < count; i++) {
+        _vectors[i].iov_len = _sizes[i];
+        _headers[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+        _headers[i].msg_hdr.msg_flags = 0;
+    }
+    while (sent < count) {
+        const std::int32_t result = sendmmsg(sock, _headers.data() + sent, static_cast<std::uint32_t>(count - sent), 0);
+
+        if (result < 0) {
+            dropped++;
+            sent++;
+            continue;
+        }
+        sent += static_cast<std::size_t>(result);
+    }
+    for (std::size_t i = 0; i < count; i++) {
+        _vectors[i].iov_len = UDP_PACKET_SIZE;
+    }
+#else
+    for (; sent < count; sent++) {
+#ifdef _WIN32
+        const std::int32_t result = sendto(sock, reinterpret_cast<const char*>(GetData(sent)), static_cast<std::int32_t>(_sizes[sent]), 0, reinterpret_cast<const struct sockaddr*>(&_addresses[sent]), sizeof(struct sockaddr_in));
+#else
+        const ssize_t result = sendto(sock, GetData(sent), _sizes[sent], 0, reinterpret_cast<const struct sockaddr*>(&_addresses[sent]), sizeof(struct sockaddr_in));
+#endif
+
+        if (result < 0) {
+            dropped++;
+        }
+    }
+#endif
+    return dropped;
+}
+
+std::size_t Wrapper::Batch::GetCount() const
+{
+    return _count;
+}
+
+std::size_t Wrapper::Batch::GetCapacity() const
+{
+    return _sizes.size();
+}
+
+const std::uint8_t* Wrapper::Batch::GetData(const std::size_t index) const
+{
+    return _storage.data() + index * UDP_PACKET_SIZE;
+}
+
+std::size_t Wrapper::Batch::GetSize(const std::size_t index) const
+{
+    return _sizes[index];
+}
+
+const struct sockaddr_in& Wrapper::Batch::GetEndpoint(const std::size_t index) const
+{
+    return _addresses[index];
+}
@@ -0,0 +1,121 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Poller.cpp
+*/
+
+#include "Exception/Generic.hpp"
+#include "Wrapper/Poller.hpp"
+#include "Variables.hpp"
+
+#include <algorithm>
+#include <format>
+
+#ifdef __linux__
+
+Wrapper::Poller::Poller() : _fd(epoll_create1(EPOLL_CLOEXEC)), _buffer(MAX_POLL_EVENTS)
+{
+    if (_fd < 0) {
+        throw Exception::GenericError(std::format("Failed to create epoll instance: {}", Socket::GetLastError()));
+    }
+}
+
+Wrapper::Poller::~Poller()
+{
+    close(_fd);
+}
+
+bool Wrapper::Poller::Add(const Socket::SocketType& sock, const bool edge)
+{
+    struct epoll_event event = {};
+
+    event.events = EPOLLIN | EPOLLRDHUP;
+    if (edge) {
+        event.events |= EPOLLET;
+    }
+    event.data.fd = sock;
+
+    return epoll_ctl(_fd, EPOLL_CTL_ADD, sock, &event) == 0;
+}
+
+bool Wrapper::Poller::Remove(const Socket::SocketType& sock)
+{
+    return epoll_ctl(_fd, EPOLL_CTL_DEL, sock, nullptr) == 0;
+}
+
+std::int32_t Wrapper::Poller::Wait(std::vector<Event>& events, std::int32_t timeout)
+{
+    const std::int32_t count = epoll_wait(_fd, _buffer.data(), static_cast<std::int32_t>(_buffer.size()), timeout);
+
+    events.clear();
+    if (count < 0 && Socket::IsInterrupted()) {
+        return 0;
+    }
+    for (std::int32_t i = 0; i < count; i++) {
+        events.push_back({
+            .socket = _buffer[i].data.fd,
+            .readable = (_buffer[i].events & EPOLLIN) != 0,
+            .hangup = (_buffer[i].events & (EPOLLHUP | EPOLLERR)) != 0
+        });
+    }
+    return count;
+}
+
+#else
+
+Wrapper::Poller::Poller() {}
+
+Wrapper::Poller::~Poller() {}
+
+bool Wrapper::Poller::Add(const Socket::SocketType& sock, const bool)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _sockets.push_back({
+        .fd = sock,
+        .events = POLLIN,
+        .revents = 0
+    });
+    return true;
+}
+
+bool Wrapper::Poller::Remove(const Socket::SocketType& sock)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    const std::size_t size = _sockets.size();
+
+    _sockets.erase(std::remove_if(_sockets.begin(), _sockets.end(), [sock](const Socket::PollType& current) {
+        return current.fd == sock;
+    }), _sockets.end());
+    return _sockets.size() != size;
+}
+
+std::int32_t Wrapper::Poller::Wait(std::vector<Event>& events, std::int32_t timeout)
+{
+    std::vector<Socket::PollType> sockets = {};
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        sockets = _sockets;
+    }
+
+    const std::int32_t count = Socket::Poll(sockets, timeout);
+
+    events.clear();
+    if (count < 0 && Socket::IsInterrupted()) {
+        return 0;
+    }
+    for (const Socket::PollType& socket : sockets) {
+        if (socket.revents != 0) {
+            events.push_back({
+                .socket = socket.fd,
+                .readable = (socket.revents & POLLIN) != 0,
+                .hangup = (socket.revents & (POLLHUP | POLLERR | POLLNVAL)) != 0
+            });
+        }
+    }
+    return count;
+}
+
+#endif
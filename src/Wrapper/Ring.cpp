@@ -0,0 +1,307 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Ring.cpp
+*/
+
+#ifdef USE_IO_URING
+
+#include "Exception/Generic.hpp"
+#include "Wrapper/Ring.hpp"
+#include "Variables.hpp"
+
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <csignal>
+
+#include <algorithm>
+#include <cstring>
+#include <cerrno>
+#include <format>
+#include <atomic>
+
+Wrapper::Ring::Ring(const Socket::SocketType& sock) : _socket(sock), _fd(-1), _params({}), _sqRing(nullptr), _cqRing(nullptr), _entries(nullptr), _size(0), _pending(0), _buffers(nullptr), _storage(static_cast<std::size_t>(RING_BUFFER_COUNT) * RING_BUFFER_SIZE), _header({}), _armed(false), _error(0), _slots(RING_ENTRIES)
+{
+    _fd = static_cast<std::int32_t>(syscall(__NR_io_uring_setup, RING_ENTRIES, &_params));
+    if (_fd < 0) {
+        throw Exception::GenericError(std::format("Failed to create io_uring instance: {}", Socket::GetLastError()));
+    }
+    if (!(_params.features & IORING_FEAT_SINGLE_MMAP) || !(_params.features & IORING_FEAT_EXT_ARG)) {
+        Release();
+        throw Exception::GenericError("Kernel io_uring is missing single mapping or extended arguments support");
+    }
+
+    std::vector<std::uint8_t> probe(sizeof(struct io_uring_probe) + IORING_OP_LAST * sizeof(struct io_uring_probe_op), 0);
+    const struct io_uring_probe* ops = reinterpret_cast<const struct io_uring_probe*>(probe.data());
+
+    if (syscall(__NR_io_uring_register, _fd, IORING_REGISTER_PROBE, probe.data(), IORING_OP_LAST) < 0 || ops->last_op < IORING_OP_RECVMSG || !(ops->ops[IORING_OP_RECVMSG].flags & IO_URING_OP_SUPPORTED) || !(ops->ops[IORING_OP_SENDMSG].flags & IO_URING_OP_SUPPORTED)) {
+        Release();
+        throw Exception::GenericError("Kernel io_uring is missing message receive or send support");
+    }
+
+    _size = std::max(_params.sq_off.array + _params.sq_entries * sizeof(std::uint32_t), _params.cq_off.cqes + _params.cq_entries * sizeof(struct io_uring_cqe));
+
+    void* rings = mmap(nullptr, _size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fd, IORING_OFF_SQ_RING);
+    void* entries = mmap(nullptr, _params.sq_entries * sizeof(struct io_uring_sqe), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fd, IORING_OFF_SQES);
+    void* buffers = mmap(nullptr, RING_BUFFER_COUNT * sizeof(struct io_uring_buf), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    _sqRing = rings != MAP_FAILED ? static_cast<std::uint8_t*>(rings) : nullptr;
+    _cqRing = _sqRing;
+    _entries = entries != MAP_FAILED ? static_cast<struct io_uring_sqe*>(entries) : nullptr;
+    _buffers = buffers != MAP_FAILED ? static_cast<struct io_uring_buf_ring*>(buffers) : nullptr;
+
+    if (!_sqRing || !_entries || !_buffers) {
+        const std::string error = Socket::GetLastError();
+
+        Release();
+        throw Exception::GenericError(std::format("Failed to map io_uring memory: {}", error));
+    }
+
+    struct io_uring_buf_reg registration = {};
+
+    registration.ring_addr = reinterpret_cast<std::uint64_t>(_buffers);
+    registration.ring_entries = RING_BUFFER_COUNT;
+    registration.bgid = RING_BUFFER_GROUP;
+    if (syscall(__NR_io_uring_register, _fd, IORING_REGISTER_PBUF_RING, &registration, 1) < 0) {
+        const std::string error = Socket::GetLastError();
+
+        Release();
+        throw Exception::GenericError(std::format("Failed to register io_uring buffers: {}", error));
+    }
+    for (std::uint16_t i = 0; i < RING_BUFFER_COUNT; i++) {
+        Recycle(i);
+    }
+
+    _header.msg_namelen = sizeof(struct sockaddr_in);
+
+    _free.reserve(_slots.size());
+    for (std::uint32_t i = 0; i < _slots.size(); i++) {
+        _free.push_back(static_cast<std::uint32_t>(_slots.size()) - 1 - i);
+    }
+}
+
+Wrapper::Ring::~Ring()
+{
+    Release();
+}
+
+void Wrapper::Ring::Release()
+{
+    if (_buffers) {
+        munmap(_buffers, RING_BUFFER_COUNT * sizeof(struct io_uring_buf));
+        _buffers = nullptr;
+    }
+    if (_entries) {
+        munmap(_entries, _params.sq_entries * sizeof(struct io_uring_sqe));
+        _entries = nullptr;
+    }
+    if (_sqRing) {
+        munmap(_sqRing, _size);
+        _sqRing = nullptr;
+    }
+    if (_fd >= 0) {
+        close(_fd);
+        _fd = -1;
+    }
+}
+
+std::int32_t Wrapper::Ring::ReceiveFrom(std::vector<Socket::Datagram>& datagrams, std::int32_t timeout)
+{
+    datagrams.clear();
+    if (!_armed) {
+        Arm();
+    }
+    if (Enter(1, timeout) < 0 && errno != ETIME && errno != EINTR) {
+        return -1;
+    }
+    Reap(datagrams);
+    if (_error != 0) {
+        errno = _error;
+        return -1;
+    }
+    return static_cast<std::int32_t>(datagrams.size());
+}
+
+bool Wrapper::Ring::SendTo(const std::vector<std::uint8_t>& data, const struct sockaddr_in& endpoint)
+{
+    if (data.empty()) {
+        return false;
+    }
+    if (_free.empty() || _pending >= _params.sq_entries) {
+        std::vector<Socket::Datagram> ignored = {};
+
+        Enter(_free.empty() ? 1 : 0, -1);
+        Reap(ignored);
+        if (_free.empty()) {
+            return false;
+        }
+    }
+
+    struct io_uring_sqe* entry = GetEntry();
+
+    if (!entry) {
+        return false;
+    }
+
+    const std::uint32_t index = _free.back();
+    Slot& slot = _slots[index];
+
+    _free.pop_back();
+    slot.address = endpoint;
+    slot.data = data;
+    slot.vector = { .iov_base = slot.data.data(), .iov_len = slot.data.size() };
+    slot.header = {};
+    slot.header.msg_name = &slot.address;
+    slot.header.msg_namelen = sizeof(slot.address);
+    slot.header.msg_iov = &slot.vector;
+    slot.header.msg_iovlen = 1;
+
+    entry->opcode = IORING_OP_SENDMSG;
+    entry->fd = _socket;
+    entry->addr = reinterpret_cast<std::uint64_t>(&slot.header);
+    entry->len = 1;
+    entry->user_data = (static_cast<std::uint64_t>(Operation::Send) << 32) | index;
+    return true;
+}
+
+std::int32_t Wrapper::Ring::Flush()
+{
+    const std::uint32_t submitted = _pending;
+    std::vector<Socket::Datagram> ignored = {};
+
+    if (submitted > 0 && Enter(0, -1) < 0) {
+        return -1;
+    }
+    Reap(ignored);
+    return static_cast<std::int32_t>(submitted);
+}
+
+struct io_uring_sqe* Wrapper::Ring::GetEntry()
+{
+    const std::uint32_t head = Field(_sqRing, _params.sq_off.head).load(std::memory_order_acquire);
+    const std::uint32_t tail = Field(_sqRing, _params.sq_off.tail).load(std::memory_order_relaxed);
+
+    if (tail - head >= _params.sq_entries) {
+        return nullptr;
+    }
+
+    const std::uint32_t index = tail & Field(_sqRing, _params.sq_off.ring_mask).load(std::memory_order_relaxed);
+    struct io_uring_sqe* entry = &_entries[index];
+
+    std::memset(entry, 0, sizeof(*entry));
+    reinterpret_cast<std::uint32_t*>(_sqRing + _params.sq_off.array)[index] = index;
+    Field(_sqRing, _params.sq_off.tail).store(tail + 1, std::memory_order_release);
+    _pending++;
+    return entry;
+}
+
+void Wrapper::Ring::Arm()
+{
+    struct io_uring_sqe* entry = GetEntry();
+
+    if (entry) {
+        entry->opcode = IORING_OP_RECVMSG;
+        entry->fd = _socket;
+        entry->addr = reinterpret_cast<std::uint64_t>(&_header);
+        entry->len = 1;
+        entry->ioprio = IORING_RECV_MULTISHOT;
+        entry->flags = IOSQE_BUFFER_SELECT;
+        entry->buf_group = RING_BUFFER_GROUP;
+        entry->user_data = static_cast<std::uint64_t>(Operation::Receive) << 32;
+        _armed = true;
+    }
+}
+
+void Wrapper::Ring::Recycle(const std::uint16_t index)
+{
+    std::atomic_ref<std::uint16_t> tail(_buffers->tail);
+    const std::uint16_t current = tail.load(std::memory_order_relaxed);
+    struct io_uring_buf& buffer = reinterpret_cast<struct io_uring_buf*>(_buffers)[current & (RING_BUFFER_COUNT - 1)];
+
+    buffer.addr = reinterpret_cast<std::uint64_t>(_storage.data() + static_cast<std::size_t>(index) * RING_BUFFER_SIZE);
+    buffer.len = RING_BUFFER_SIZE;
+    buffer.bid = index;
+    tail.store(current + 1, std::memory_order_release);
+}
+
+std::int32_t Wrapper::Ring::Enter(const std::uint32_t wait, const std::int32_t timeout)
+{
+    struct __kernel_timespec ts = { .tv_sec = timeout / 1000, .tv_nsec = (timeout % 1000) * 1000000LL };
+    struct io_uring_getevents_arg arg = {};
+    std::uint32_t flags = wait > 0 ? IORING_ENTER_GETEVENTS : 0;
+
+    if (wait > 0 && timeout >= 0) {
+        arg.sigmask_sz = _NSIG / 8;
+        arg.ts = reinterpret_cast<std::uint64_t>(&ts);
+        flags |= IORING_ENTER_EXT_ARG;
+    }
+
+    const std::uint32_t submitted = _pending;
+    const std::int32_t result = static_cast<std::int32_t>(syscall(__NR_io_uring_enter, _fd, submitted, wait, flags, (flags & IORING_ENTER_EXT_ARG) ? &arg : nullptr, sizeof(arg)));
+
+    if (result >= 0) {
+        _pending -= std::min(_pending, static_cast<std::uint32_t>(result));
+    }
+    return result;
+}
+
+void Wrapper::Ring::Reap(std::vector<Socket::Datagram>& datagrams)
+{
+    std::uint32_t head = Field(_cqRing, _params.cq_off.head).load(std::memory_order_relaxed);
+    const std::uint32_t tail = Field(_cqRing, _params.cq_off.tail).load(std::memory_order_acquire);
+    const std::uint32_t mask = Field(_cqRing, _params.cq_off.ring_mask).load(std::memory_order_relaxed);
+    const struct io_uring_cqe* completions = reinterpret_cast<const struct io_uring_cqe*>(_cqRing + _params.cq_off.cqes);
+
+    for (; head != tail; head++) {
+        const struct io_uring_cqe& completion = completions[head & mask];
+        const Operation operation = static_cast<Operation>(completion.user_data >> 32);
+
+        if (operation == Operation::Send) {
+            const std::uint32_t index = static_cast<std::uint32_t>(completion.user_data);
+
+            _slots[index].data.clear();
+            _free.push_back(index);
+            continue;
+        }
+
+        if (!(completion.flags & IORING_CQE_F_MORE)) {
+            _armed = false;
+        }
+        if (completion.res < 0 && completion.res != -ENOBUFS) {
+            _error = -completion.res;
+        }
+        if (!(completion.flags & IORING_CQE_F_BUFFER)) {
+            continue;
+        }
+
+        const std::uint16_t index = static_cast<std::uint16_t>(completion.flags >> IORING_CQE_BUFFER_SHIFT);
+        const std::uint8_t* buffer = _storage.data() + static_cast<std::size_t>(index) * RING_BUFFER_SIZE;
+
+        if (completion.res >= static_cast<std::int32_t>(sizeof(struct io_uring_recvmsg_out))) {
+            struct io_uring_recvmsg_out out = {};
+            struct sockaddr_in address = {};
+
+            std::memcpy(&out, buffer, sizeof(out));
+            std::memcpy(&address, buffer + sizeof(out), std::min<std::size_t>(out.namelen, sizeof(address)));
+
+            const std::uint8_t* payload = buffer + sizeof(out) + _header.msg_namelen + _header.msg_controllen;
+
+            if (out.payloadlen > 0 && !(out.flags & MSG_TRUNC)) {
+                datagrams.push_back({
+                    .endpoint = address,
+                    .data = std::vector<std::uint8_t>(payload, payload + out.payloadlen)
+                });
+            }
+        }
+        Recycle(index);
+    }
+    Field(_cqRing, _params.cq_off.head).store(head, std::memory_order_release);
+}
+
+std::atomic_ref<std::uint32_t> Wrapper::Ring::Field(std::uint8_t* ring, const std::uint32_t offset)
+{
+    return std::atomic_ref<std::uint32_t>(*reinterpret_cast<std::uint32_t*>(ring + offset));
+}
+
+#endif
@@ -83,6 +83,21 @@ bool Wrapper::Socket::Close(const SocketType& sock)
 #endif
 }
 
+bool Wrapper::Socket::Shutdown(const SocketType& sock)
+{
+#ifdef _WIN32
+    if (IsValid(sock)) {
+        return shutdown(sock, SD_BOTH) == 0;
+    }
+    return false;
+#else
+    if (IsValid(sock)) {
+        return shutdown(sock, SHUT_RDWR) == 0;
+    }
+    return false;
+#endif
+}
+
 bool Wrapper::Socket::Connect(const SocketType& sock, const std::string& address, std::uint16_t port)
 {
     struct sockaddr_in addr = {};
@@ -231,6 +246,102 @@ bool Wrapper::Socket::SetReuse(const SocketType& sock, bool reuse)
 #endif
 }
 
+bool Wrapper::Socket::SetNonBlocking(const SocketType& sock, bool enable)
+{
+#ifdef _WIN32
+    u_long mode = enable ? 1 : 0;
+
+    if (IsValid(sock)) {
+        return ioctlsocket(sock, FIONBIO, &mode) != SOCKET_ERROR;
+    }
+    return false;
+#else
+    if (IsValid(sock)) {
+        const std::int32_t flags = fcntl(sock, F_GETFL, 0);
+
+        if (flags < 0) {
+            return false;
+        }
+        return fcntl(sock, F_SETFL, enable ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK)) >= 0;
+    }
+    return false;
+#endif
+}
+
+bool Wrapper::Socket::SetSteering([[maybe_unused]] const SocketType& sock, [[maybe_unused]] std::uint32_t count)
+{
+#if defined(__linux__) && defined(SO_ATTACH_REUSEPORT_CBPF)
+    struct sock_filter code[] = {
+        { BPF_LD | BPF_W | BPF_ABS, 0, 0, static_cast<std::uint32_t>(SKF_AD_OFF + SKF_AD_CPU) },
+        { BPF_ALU | BPF_MOD | BPF_K, 0, 0, count },
+        { BPF_RET | BPF_A, 0, 0, 0 }
+    };
+    struct sock_fprog program = { .len = sizeof(code) / sizeof(code[0]), .filter = code };
+
+    if (IsValid(sock) && count > 0) {
+        return setsockopt(sock, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &program, sizeof(program)) >= 0;
+    }
+    return false;
+#else
+    return false;
+#endif
+}
+
+bool Wrapper::Socket::SetNoDelay(const SocketType& sock, bool enable)
+{
+    std::int32_t opt = enable ? 1 : 0;
+
+#ifdef _WIN32
+    if (IsValid(sock)) {
+        return setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&opt), static_cast<int>(sizeof(opt))) != SOCKET_ERROR;
+    }
+    return false;
+#else
+    if (IsValid(sock)) {
+        return setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &opt, sizeof(opt)) >= 0;
+    }
+    return false;
+#endif
+}
+
+Wrapper::Socket::BufferType Wrapper::Socket::MakeBuffer(const std::uint8_t* data, std::size_t size)
+{
+#ifdef _WIN32
+    return { .len = static_cast<ULONG>(size), .buf = reinterpret_cast<CHAR*>(const_cast<std::uint8_t*>(data)) };
+#else
+    return { .iov_base = const_cast<std::uint8_t*>(data), .iov_len = size };
+#endif
+}
+
+Wrapper::Socket::TransmitType Wrapper::Socket::Send(const SocketType& sock, std::vector<BufferType>& buffers)
+{
+    if (buffers.empty()) {
+        return 0;
+    }
+
+#ifdef _WIN32
+    DWORD bytes = 0;
+
+    if (IsValid(sock) && WSASend(sock, buffers.data(), static_cast<DWORD>(buffers.size()), &bytes, 0, nullptr, nullptr) != SOCKET_ERROR) {
+        return static_cast<TransmitType>(bytes);
+    }
+    return -1;
+#else
+    struct msghdr message = {};
+
+    message.msg_iov = buffers.data();
+    message.msg_iovlen = buffers.size();
+    if (IsValid(sock)) {
+#ifdef MSG_NOSIGNAL
+        return ::sendmsg(sock, &message, MSG_NOSIGNAL);
+#else
+        return ::sendmsg(sock, &message, 0);
+#endif
+    }
+    return -1;
+#endif
+}
+
 Wrapper::Socket::TransmitType Wrapper::Socket::Send(const SocketType& sock, const std::vector<std::uint8_t>& raw)
 {
     if (raw.empty()) {
@@ -272,6 +383,19 @@ std::vector<std::uint8_t> Wrapper::Socket::Receive(const SocketType& sock, std::
     return {};
 }
 
+Wrapper::Socket::TransmitType Wrapper::Socket::Receive(const SocketType& sock, std::uint8_t* buffer, std::size_t size)
+{
+    if (size == 0) {
+        return -1;
+    }
+
+#ifdef _WIN32
+    return recv(sock, reinterpret_cast<char*>(buffer), static_cast<std::int32_t>(size), 0);
+#else
+    return ::recv(sock, buffer, size, 0);
+#endif
+}
+
 std::int32_t Wrapper::Socket::Poll(std::vector<PollType>& fds, std::int32_t timeout)
 {
     if (fds.empty()) {
@@ -312,28 +436,46 @@ std::vector<std::uint8_t> Wrapper::Socket::ReceiveFrom(const SocketType& sock, s
 }
 
 Wrapper::Socket::TransmitType Wrapper::Socket::SendTo(const SocketType& sock, const std::vector<std::uint8_t>& data, const std::string& address, std::uint16_t port)
+{
+    struct sockaddr_in endpoint = {};
+
+    if (!ToEndpoint(address, port, endpoint)) {
+        return -1;
+    }
+    return SendTo(sock, data, endpoint);
+}
+
+Wrapper::Socket::TransmitType Wrapper::Socket::SendTo(const SocketType& sock, const std::vector<std::uint8_t>& data, const struct sockaddr_in& endpoint)
 {
     if (data.empty()) {
         return -1;
     }
 
-    struct sockaddr_in addr = {};
-    addr.sin_family = AF_INET;
-    addr.sin_port = htons(port);
+#ifdef _WIN32
+    return sendto(sock, reinterpret_cast<const char*>(data.data()), static_cast<std::int32_t>(data.size()), 0, (const struct sockaddr*)&endpoint, sizeof(endpoint));
+#else
+    return sendto(sock, data.data(), data.size(), 0, (const struct sockaddr*)&endpoint, sizeof(endpoint));
+#endif
+}
+
+bool Wrapper::Socket::ToEndpoint(const std::string& address, std::uint16_t port, struct sockaddr_in& endpoint)
+{
+    endpoint = {};
+    endpoint.sin_family = AF_INET;
+    endpoint.sin_port = htons(port);
 
 #ifdef _WIN32
-    if (InetPtonA(AF_INET, address.c_str(), &addr.sin_addr) != 1) {
-        return -1;
-    }
-    return sendto(sock, reinterpret_cast<const char*>(data.data()), static_cast<std::int32_t>(data.size()), 0, (struct sockaddr*)&addr, sizeof(addr));
+    return InetPtonA(AF_INET, address.c_str(), &endpoint.sin_addr) == 1;
 #else
-    if (inet_pton(AF_INET, address.c_str(), &addr.sin_addr) <= 0) {
-        return -1;
-    }
-    return sendto(sock, data.data(), data.size(), 0, (struct sockaddr*)&addr, sizeof(addr));
+    return inet_pton(AF_INET, address.c_str(), &endpoint.sin_addr) > 0;
 #endif
 }
 
+Wrapper::Socket::EndpointKey Wrapper::Socket::ToKey(const struct sockaddr_in& endpoint)
+{
+    return (static_cast<EndpointKey>(ntohl(endpoint.sin_addr.s_addr)) << 16) | ntohs(endpoint.sin_port);
+}
+
 std::string Wrapper::Socket::GetLastError()
 {
 #ifdef _WIN32
@@ -354,3 +496,30 @@ std::string Wrapper::Socket::GetLastError()
     return std::string(std::strerror(errno));
 #endif
 }
+
+bool Wrapper::Socket::WouldBlock()
+{
+#ifdef _WIN32
+    return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+    return errno == EAGAIN || errno == EWOULDBLOCK;
+#endif
+}
+
+bool Wrapper::Socket::IsInterrupted()
+{
+#ifdef _WIN32
+    return WSAGetLastError() == WSAEINTR;
+#else
+    return errno == EINTR;
+#endif
+}
+
+bool Wrapper::Socket::IsExhausted()
+{
+#ifdef _WIN32
+    return WSAGetLastError() == WSAEMFILE;
+#else
+    return errno == EMFILE || errno == ENFILE;
+#endif
+}